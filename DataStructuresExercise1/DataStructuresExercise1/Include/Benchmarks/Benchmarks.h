@@ -0,0 +1,65 @@
+#ifndef INCLUDE_BENCHMARKS_BENCHMARKS__H
+#define INCLUDE_BENCHMARKS_BENCHMARKS__H
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace benchmarks
+{
+	// Returns how many seconds it took to run 'function'
+	template<typename Function>
+	inline auto MeasureSeconds(Function&& function)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		function();
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	// The most memory this process has used so far (0 when the platform can't tell)
+	std::size_t GetPeakMemoryBytes();
+
+	// The size of the stack of the calling thread (0 when the platform can't tell or it has no limit)
+	std::size_t GetStackBytes();
+
+	// Removes the file at 'path' however the benchmark that made it ends
+	class TemporaryFile
+	{
+	public:
+		// Constructors
+		explicit TemporaryFile(std::string path) : path(std::move(path)) {}
+		TemporaryFile(const TemporaryFile& other) = delete;
+
+		// Destructor
+		~TemporaryFile();
+
+		// Assignment Operator Methods
+		TemporaryFile& operator=(const TemporaryFile& other) = delete;
+
+		// Getters
+		inline const auto& GetPath() const { return path; }
+
+	private:
+		// Data Members
+		std::string path;
+	};
+
+	// Benchmarks (every benchmark receives the command line arguments that came after its name)
+	void RunReorderingBenchmark(const std::vector<std::string>& arguments);
+	void RunScalingBenchmark(const std::vector<std::string>& arguments);
+	void RunCompressionBenchmark(const std::vector<std::string>& arguments);
+	void RunExternalBenchmark(const std::vector<std::string>& arguments);
+	void RunShortestPathsBenchmark(const std::vector<std::string>& arguments);
+	void RunBatchBenchmark(const std::vector<std::string>& arguments);
+	void RunLinearizeBenchmark(const std::vector<std::string>& arguments);
+	void RunDynamicBenchmark(const std::vector<std::string>& arguments);
+	void RunSearchBenchmark(const std::vector<std::string>& arguments);
+	void RunBuildBenchmark(const std::vector<std::string>& arguments);
+
+	// Runs the benchmark called 'name'
+	void RunBenchmark(const std::string& name, const std::vector<std::string>& arguments);
+}
+
+#endif // !INCLUDE_BENCHMARKS_BENCHMARKS__H
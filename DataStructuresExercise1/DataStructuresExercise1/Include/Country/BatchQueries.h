@@ -0,0 +1,363 @@
+#ifndef INCLUDE_COUNTRY_BATCHQUERIES__H
+#define INCLUDE_COUNTRY_BATCHQUERIES__H
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Country/Country.h"
+#include "DataStructures/Deque.h"
+#include "DataStructures/Queue.h"
+#include "DataStructures/Stack.h"
+#include "DataStructures/LinkedList/StaticLinkedListArray.h"
+
+// Answers a stream of source towns on a country that's built once. The queries are taken on the calling thread,
+// traversed by a fixed pool of workers, and written by a writer thread in the order they were read.
+namespace batch
+{
+	// Consts
+	constexpr size_t QUERIES_PER_WORKER = 64;	// How far the pool can run ahead of the writer
+	constexpr size_t SMALL_COUNTRY_TOWNS = 1024;	// Countries up to this size traverse with a stack that lives in the traverser
+
+	inline void AppendNumber(std::string& text, std::uint64_t number)
+	{
+		char digits[20];
+		int length = 0;
+
+		do
+		{
+			digits[length++] = static_cast<char>('0' + number % 10);
+			number /= 10;
+		} while (number != 0);
+
+		while (length > 0) text.push_back(digits[--length]);
+	}
+
+	// Everything a worker needs for a traversal, kept between the queries so they don't allocate once it has grown.
+	// The visited towns are marked with the number of the query instead of a color, so they never have to be cleared.
+	// The stack never holds more than one item per town, so with 'MaxTowns' it's a fixed list that never allocates.
+	template<typename CountryType, size_t MaxTowns = 0>
+	class Traverser
+	{
+	public:
+		// Constructors
+		explicit Traverser(const CountryType& country) : country(country), visits(country.size(), 0), query(0)
+		{
+			if (MaxTowns != 0 && country.size() > MaxTowns) throw COUNTRY_TOO_LARGE;
+		}
+
+		// Appends the towns that can be reached from 'townNumber' (zero based) to 'result', in the order of 'iterative::GetToTown'
+		void GetToTown(unsigned int townNumber, std::string& result)
+		{
+			if (++query == 0)
+			{
+				std::fill(visits.begin(), visits.end(), 0);
+				query = 1;
+			}
+
+			stack.MakeEmpty();
+			Visit(townNumber, result);
+			stack.Push({ townNumber, country[townNumber].begin() });
+
+			while (!stack.IsEmpty())
+			{
+				auto current = stack.Pop();
+				const auto end = country[current.townNumber].end();
+
+				while (current.neighborIterator != end && visits[*current.neighborIterator] == query) ++current.neighborIterator;
+				if (current.neighborIterator == end) continue;
+
+				const auto neighbor = *current.neighborIterator;
+				stack.Push(current);
+
+				Visit(neighbor, result);
+				stack.Push({ neighbor, country[neighbor].begin() });
+			}
+		}
+
+	private:
+		// Error Messages
+		static constexpr auto COUNTRY_TOO_LARGE = "The country has more towns than the traverser's stack can hold!";
+
+		// Subclasses
+		struct Item
+		{
+			unsigned int townNumber;
+			decltype(std::declval<const CountryType&>()[0].begin()) neighborIterator;
+		};
+
+		// Emptying a deque keeps its buffer, and the fixed list has no buffer to allocate
+		using ItemStack = std::conditional_t<MaxTowns == 0,
+											 containers::Stack<Item, containers::Deque<Item>>,
+											 containers::Stack<Item, containers::StaticLinkedListArray<Item, MaxTowns>>>;
+
+		// Data Members
+		const CountryType& country;
+		std::vector<unsigned int> visits;
+		unsigned int query;
+		ItemStack stack;
+
+		// Methods
+		inline void Visit(unsigned int townNumber, std::string& result)
+		{
+			visits[townNumber] = query;
+			AppendNumber(result, townNumber + 1);
+			result.push_back(' ');
+		}
+	};
+
+	// A bounded queue of (sequence number, source town) jobs, closed once the input is over or aborted when something failed
+	class JobQueue
+	{
+	public:
+		// Constructors
+		explicit JobQueue(size_t capacity) : capacity(capacity), isClosed(false), isAborted(false) { jobs.Reserve(capacity); }
+
+		// Waits while the queue is full, returns false once it was aborted
+		bool Push(std::uint64_t sequence, std::int64_t townNumber)
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			notFull.wait(lock, [this]() { return jobs.Size() < capacity || isAborted; });
+			if (isAborted) return false;
+
+			jobs.Enqueue({ sequence, townNumber });
+			notEmpty.notify_one();
+
+			return true;
+		}
+
+		// Waits for a job, returns false once the queue is closed and empty, or aborted
+		bool Pop(std::pair<std::uint64_t, std::int64_t>& job)
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			notEmpty.wait(lock, [this]() { return !jobs.IsEmpty() || isClosed; });
+			if (jobs.IsEmpty() || isAborted) return false;
+
+			job = jobs.Dequeue();
+			notFull.notify_one();
+
+			return true;
+		}
+
+		void Close()
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			isClosed = true;
+			notEmpty.notify_all();
+		}
+
+		// Wakes everyone up and drops the jobs that are left
+		void Abort()
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			isClosed = true;
+			isAborted = true;
+			notEmpty.notify_all();
+			notFull.notify_all();
+		}
+
+	private:
+		// Data Members
+		containers::Queue<std::pair<std::uint64_t, std::int64_t>> jobs;
+		size_t capacity;
+		bool isClosed;
+		bool isAborted;
+		std::mutex mutex;
+		std::condition_variable notEmpty;
+		std::condition_variable notFull;
+	};
+
+	// Holds the results that are done before the ones ahead of them. Slot 'sequence % capacity' belongs to 'sequence',
+	// and a worker that's a whole buffer ahead of the writer waits, so the memory stays bounded however long the input is.
+	class ReorderBuffer
+	{
+	public:
+		// Constructors
+		explicit ReorderBuffer(size_t capacity) : slots(capacity), isReady(capacity, false), next(0), total(UNKNOWN_TOTAL), isAborted(false) { }
+
+		// Copies 'result' into its slot, the slots keep their memory so this doesn't allocate once they have grown
+		void Put(std::uint64_t sequence, const std::string& result)
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			hasRoom.wait(lock, [&]() { return sequence < next + slots.size() || isAborted; });
+			if (isAborted) return;
+
+			const auto slot = sequence % slots.size();
+			slots[slot].assign(result);
+			isReady[slot] = true;
+
+			if (sequence == next) hasNext.notify_one();
+		}
+
+		// No results come after 'count' of them
+		void SetTotal(std::uint64_t count)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			total = count;
+			hasNext.notify_one();
+		}
+
+		// Swaps the next result into 'result', returns false once all of them were taken or the buffer was aborted
+		bool TakeNext(std::string& result)
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			hasNext.wait(lock, [this]() { return next == total || isReady[next % slots.size()] || isAborted; });
+			if (next == total || isAborted) return false;
+
+			const auto slot = next % slots.size();
+			result.swap(slots[slot]);
+			isReady[slot] = false;
+			++next;
+			hasRoom.notify_all();
+
+			return true;
+		}
+
+		// Wakes everyone up, the results that are left are never written
+		void Abort()
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			isAborted = true;
+			hasNext.notify_all();
+			hasRoom.notify_all();
+		}
+
+	private:
+		// Consts
+		static constexpr auto UNKNOWN_TOTAL = ~std::uint64_t(0);
+
+		// Data Members
+		std::vector<std::string> slots;
+		std::vector<bool> isReady;
+		std::uint64_t next;
+		std::uint64_t total;
+		bool isAborted;
+		std::mutex mutex;
+		std::condition_variable hasNext;
+		std::condition_variable hasRoom;
+	};
+
+	// Takes source towns (one based) from 'nextQuery(townNumber)' until it returns false, and writes a line of reachable
+	// towns for each of them to 'output', in the order they were taken. Returns the number of queries.
+	// When a thread or 'nextQuery' throws, the queues are aborted, every thread is joined, and the first exception is rethrown.
+	template<typename CountryType, typename NextQuery>
+	std::uint64_t AnswerQueries(const CountryType& country, NextQuery&& nextQuery, std::ostream& output, unsigned int numberOfWorkers)
+	{
+		numberOfWorkers = std::max(numberOfWorkers, 1u);
+
+		JobQueue jobs(numberOfWorkers * QUERIES_PER_WORKER);
+		ReorderBuffer results(numberOfWorkers * QUERIES_PER_WORKER);
+
+		std::exception_ptr failure;
+		std::mutex failureMutex;
+		auto fail = [&]()
+		{
+			{
+				std::lock_guard<std::mutex> lock(failureMutex);
+				if (!failure) failure = std::current_exception();
+			}
+
+			jobs.Abort();
+			results.Abort();
+		};
+
+		std::vector<std::thread> workers;
+		std::thread writer;
+		std::uint64_t numberOfQueries = 0;
+
+		try
+		{
+			workers.reserve(numberOfWorkers);
+			for (unsigned int worker = 0; worker < numberOfWorkers; worker++)
+			{
+				workers.emplace_back([&]()
+				{
+					try
+					{
+						auto answerJobs = [&](auto& traverser)
+						{
+							std::string result;
+							std::pair<std::uint64_t, std::int64_t> job;
+
+							while (jobs.Pop(job))
+							{
+								result.clear();
+
+								// A bad query only fails its own line
+								if (job.second <= 0 || static_cast<std::uint64_t>(job.second) > country.size())
+								{
+									result += "invalid input";
+								}
+								else
+								{
+									result += "Cities accessible from source city ";
+									AppendNumber(result, static_cast<std::uint64_t>(job.second));
+									result += " (iterative algorithm): ";
+									traverser.GetToTown(static_cast<unsigned int>(job.second - 1), result);
+								}
+
+								result.push_back('\n');
+								results.Put(job.first, result);
+							}
+						};
+
+						if (country.size() <= SMALL_COUNTRY_TOWNS)
+						{
+							Traverser<CountryType, SMALL_COUNTRY_TOWNS> traverser(country);
+							answerJobs(traverser);
+						}
+						else
+						{
+							Traverser<CountryType> traverser(country);
+							answerJobs(traverser);
+						}
+					}
+					catch (...)
+					{
+						fail();
+					}
+				});
+			}
+
+			writer = std::thread([&]()
+			{
+				try
+				{
+					std::string result;
+					while (results.TakeNext(result)) output.write(result.data(), static_cast<std::streamsize>(result.size()));
+					output.flush();
+				}
+				catch (...)
+				{
+					fail();
+				}
+			});
+
+			std::int64_t townNumber;
+			while (nextQuery(townNumber) && jobs.Push(numberOfQueries, townNumber)) ++numberOfQueries;
+		}
+		catch (...)
+		{
+			fail();
+		}
+
+		jobs.Close();
+		for (auto& worker : workers) worker.join();
+
+		results.SetTotal(numberOfQueries);
+		if (writer.joinable()) writer.join();
+
+		if (failure) std::rethrow_exception(failure);
+
+		return numberOfQueries;
+	}
+}
+
+#endif // !INCLUDE_COUNTRY_BATCHQUERIES__H
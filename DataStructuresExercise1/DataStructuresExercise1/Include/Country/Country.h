@@ -0,0 +1,223 @@
+#ifndef INCLUDE_COUNTRY_COUNTRY__H
+#define INCLUDE_COUNTRY_COUNTRY__H
+
+#include <memory>
+#include <utility>
+#include <vector>
+#include "DataStructures/AdjacencyArray.h"
+#include "DataStructures/CompressedAdjacency.h"
+#include "DataStructures/LinkedList/LinkedListPointers.h"
+#include "DataStructures/LinkedList/LinkedListArray.h"
+#include "DataStructures/Queue.h"
+#include "DataStructures/SmallList.h"
+#include "DataStructures/Stack.h"
+
+using Color = bool;
+constexpr auto WHITE = true;
+constexpr auto BLACK = false;
+
+struct UserInput
+{
+	struct Pair
+	{
+		unsigned int source;
+		unsigned int destination;
+	};
+
+	unsigned int numberOfTowns;
+	std::vector<Pair> pairs;
+	unsigned int source;
+};
+
+using Country = std::vector<containers::LinkedListPointers<unsigned int>>;
+
+// Most towns only have a handful of roads, which fit inside the town's own list without any allocation
+using SmallCountry = std::vector<containers::SmallList<unsigned int>>;
+
+template<typename CountryType = Country>
+auto GetCountryFromUserInput(const UserInput& userInput)
+{
+	CountryType country(userInput.numberOfTowns);
+
+	// Counting the roads of every town first lets each town get all of its storage in a single allocation
+	std::vector<unsigned int> degrees(userInput.numberOfTowns, 0);
+	for (const auto& pair : userInput.pairs) ++degrees[pair.source - 1];
+	for (unsigned int town = 0; town < userInput.numberOfTowns; town++) country[town].Reserve(degrees[town]);
+
+	for (const auto& pair : userInput.pairs)
+	{
+		country[pair.source - 1].Append(pair.destination - 1);
+	}
+
+	return country;
+}
+
+// All the roads in a single array, built by a pool of workers. The roads of every town keep the order of the input
+// (unless they're sorted), so the traversals on it reach the same towns in the same order as on the lists.
+using CsrCountry = containers::AdjacencyArray;
+
+inline auto GetCsrCountryFromUserInput(const UserInput& userInput, unsigned int numberOfWorkers, bool isSortedAndUnique = false)
+{
+	return CsrCountry(userInput.numberOfTowns, userInput.pairs, [](const UserInput::Pair& pair)
+	{
+		return std::make_pair(pair.source - 1, pair.destination - 1);
+	}, numberOfWorkers, isSortedAndUnique);
+}
+
+// The neighbors of every town are sorted and deduplicated, so the traversals on it reach the same towns in a different order
+template<typename Codec = containers::codecs::Varint>
+using CompressedCountry = containers::CompressedAdjacency<Codec>;
+
+template<typename Codec = containers::codecs::Varint>
+auto GetCompressedCountryFromUserInput(const UserInput& userInput)
+{
+	return CompressedCountry<Codec>(userInput.numberOfTowns, userInput.pairs, [](const UserInput::Pair& pair)
+	{
+		return std::make_pair(pair.source - 1, pair.destination - 1);
+	});
+}
+
+namespace recursive
+{
+	template<typename CountryType, typename ColorAllocator, typename TownAllocator>
+	void GetToTown(const CountryType& country,
+				   unsigned int townNumber,
+				   std::vector<Color, ColorAllocator>& coloredTowns,
+				   containers::LinkedListArray<unsigned int, TownAllocator>& accessibleTowns)
+	{
+		coloredTowns[townNumber] = BLACK;
+		accessibleTowns.Append(townNumber);
+
+		for (const auto& neighbor : country[townNumber])
+		{
+			if (coloredTowns[neighbor] == WHITE)
+			{
+				GetToTown(country, neighbor, coloredTowns, accessibleTowns);
+			}
+		}
+	}
+};
+
+namespace iterative
+{
+	// Everything the traversal allocates (including the towns it returns) comes from 'allocator'
+	template<typename CountryType, typename Allocator = std::allocator<unsigned int>>
+	auto GetToTown(const CountryType& country,
+				   unsigned int townNumber,
+				   const Allocator& allocator = Allocator())
+	{
+		using ColorAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Color>;
+
+		struct ItemType
+		{
+			// Enums
+			enum class Line
+			{
+				START,
+				LOOP
+			};
+
+			// Local Variables
+			containers::LinkedListArray<unsigned int, Allocator>* accessibleTowns = nullptr;
+			std::vector<Color, ColorAllocator>* coloredTowns = nullptr;
+			decltype(std::declval<const CountryType&>()[0].begin()) neighborIterator;
+
+			// Parameters
+			const CountryType* country = nullptr;
+			unsigned int townNumber = 0;
+
+			// Line
+			Line line = Line::START;
+		};
+
+		using ItemAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<ItemType>;
+
+		containers::LinkedListArray<unsigned int, Allocator> accessibleTowns(country.size(), allocator);
+		std::vector<Color, ColorAllocator> coloredTowns(country.size(), WHITE, ColorAllocator(allocator));
+
+		containers::Stack<ItemType, containers::LinkedListPointers<ItemType, ItemAllocator>> stack{ ItemAllocator(allocator) };
+		stack.Push({ &accessibleTowns,
+					 &coloredTowns,
+					 country[townNumber].begin(),
+					 &country,
+					 townNumber,
+					 ItemType::Line::START });
+
+		while (!stack.IsEmpty())
+		{
+			ItemType current = stack.Pop();
+
+			if (current.line == ItemType::Line::START)
+			{
+				(*current.coloredTowns)[current.townNumber] = BLACK;
+				current.accessibleTowns->Append(current.townNumber);
+				current.line = ItemType::Line::LOOP;
+			}
+
+			if (current.line == ItemType::Line::LOOP)
+			{
+				while (current.neighborIterator != (*current.country)[current.townNumber].end() &&
+					   (*current.coloredTowns)[*current.neighborIterator] != WHITE)
+				{
+					++current.neighborIterator;
+				}
+
+				if (current.neighborIterator != (*current.country)[current.townNumber].end())
+				{
+					stack.Push(current);
+
+					stack.Push({ current.accessibleTowns,
+								 current.coloredTowns,
+								 (*current.country)[*current.neighborIterator].begin(),
+								 current.country,
+								 *current.neighborIterator,
+								 ItemType::Line::START });
+				}
+
+			}
+		}
+
+		return accessibleTowns;
+	}
+};
+
+namespace breadthfirst
+{
+	// Reaches the same towns as the depth first traversals, nearest first. Every town enters the queue once,
+	// so the queue is reserved for all of them up front and the frontier never allocates while the traversal runs.
+	template<typename CountryType, typename Allocator = std::allocator<unsigned int>>
+	auto GetToTown(const CountryType& country,
+				   unsigned int townNumber,
+				   const Allocator& allocator = Allocator())
+	{
+		using ColorAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Color>;
+
+		containers::LinkedListArray<unsigned int, Allocator> accessibleTowns(country.size(), allocator);
+		std::vector<Color, ColorAllocator> coloredTowns(country.size(), WHITE, ColorAllocator(allocator));
+
+		containers::Queue<unsigned int, containers::Deque<unsigned int, Allocator>> frontier(allocator);
+		frontier.Reserve(country.size());
+
+		coloredTowns[townNumber] = BLACK;
+		frontier.Enqueue(townNumber);
+
+		while (!frontier.IsEmpty())
+		{
+			auto town = frontier.Dequeue();
+			accessibleTowns.Append(town);
+
+			for (const auto& neighbor : country[town])
+			{
+				if (coloredTowns[neighbor] == WHITE)
+				{
+					coloredTowns[neighbor] = BLACK;
+					frontier.Enqueue(neighbor);
+				}
+			}
+		}
+
+		return accessibleTowns;
+	}
+};
+
+#endif // !INCLUDE_COUNTRY_COUNTRY__H
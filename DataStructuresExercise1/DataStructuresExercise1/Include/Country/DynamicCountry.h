@@ -0,0 +1,99 @@
+#ifndef INCLUDE_COUNTRY_DYNAMICCOUNTRY__H
+#define INCLUDE_COUNTRY_DYNAMICCOUNTRY__H
+
+#include <cstdint>
+#include "Country/Country.h"
+
+// A country whose roads can be built and torn down between the reachability queries. Every road that's built gets a
+// handle to its entry in the neighbors of its source town, so tearing it down is O(1) instead of a scan of the whole
+// list, and two roads between the same towns can be torn down one at a time.
+// Over lists whose handles keep a generation (LinkedListArray), a road that was already torn down is caught and throws.
+// The pointer lists can't tell, so there tearing down the same road twice is as wrong as freeing a pointer twice.
+template<typename CountryType = Country>
+class DynamicCountry
+{
+public:
+	// Subclasses
+	class Road
+	{
+		// Friend Classes
+		friend class DynamicCountry;
+
+	public:
+		// Getters
+		inline auto GetSource() const { return source; }
+
+	private:
+		// Members
+		unsigned int source;
+		typename CountryType::value_type::Handle handle;
+
+		// C'tors
+		Road(unsigned int source, typename CountryType::value_type::Handle handle) : source(source), handle(handle) { }
+	};
+
+	// Constructors
+	explicit DynamicCountry(unsigned int numberOfTowns) : country(numberOfTowns), numberOfRoads(0) { }
+
+	// Getters
+	inline auto GetNumberOfTowns() const { return static_cast<unsigned int>(country.size()); }
+	inline auto GetNumberOfRoads() const { return numberOfRoads; }
+
+	// The country as it is right now, for the traversals (for example 'iterative::GetToTown(dynamic.GetCountry(), town)')
+	inline const auto& GetCountry() const { return country; }
+
+	// Methods
+	// The towns are zero based
+	auto BuildRoad(unsigned int source, unsigned int destination)
+	{
+		if (source >= country.size() || destination >= country.size()) throw TOWN_OUT_OF_RANGE;
+
+		const Road road(source, country[source].Insert(destination));
+		++numberOfRoads;
+
+		return road;
+	}
+
+	auto& TearDownRoad(const Road& road)
+	{
+		CheckRoad(road);
+		country[road.source].Erase(road.handle);
+		--numberOfRoads;
+
+		return *this;
+	}
+
+	inline auto GetDestination(const Road& road) const
+	{
+		CheckRoad(road);
+		return country[road.source][road.handle];
+	}
+
+private:
+	// Error Messages
+	static constexpr auto TOWN_OUT_OF_RANGE = "The road leads to a town that isn't in the country!";
+	static constexpr auto ROAD_TORN_DOWN = "The road was already torn down!";
+
+	// Data Members
+	CountryType country;
+	std::uint64_t numberOfRoads;
+
+	// Methods
+	// Only the lists with an 'IsValid' can tell a handle to an element they removed
+	template<typename List>
+	static auto IsTornDown(const List& neighbors, const typename List::Handle& handle, int) -> decltype(!neighbors.IsValid(handle))
+	{
+		return !neighbors.IsValid(handle);
+	}
+
+	template<typename List>
+	static auto IsTornDown(const List&, const typename List::Handle&, long) { return false; }
+
+	void CheckRoad(const Road& road) const
+	{
+		if (road.source >= country.size()) throw TOWN_OUT_OF_RANGE;
+		if (IsTornDown(country[road.source], road.handle, 0)) throw ROAD_TORN_DOWN;
+	}
+};
+
+#endif // !INCLUDE_COUNTRY_DYNAMICCOUNTRY__H
@@ -0,0 +1,367 @@
+#ifndef INCLUDE_COUNTRY_EXTERNALREACHABILITY__H
+#define INCLUDE_COUNTRY_EXTERNALREACHABILITY__H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "Country/UserIO.h"
+
+// Reachability for countries that don't fit in memory. The roads are kept in a file, sorted by their source town,
+// and the traversal goes over the country one breadth first level at a time. Every level is a single forward pass
+// over the file that only reads the blocks holding roads of towns in the frontier, so all the reading is sequential.
+// Only the bitmaps of the visited towns and of the frontier and one block of roads are ever in memory.
+namespace external
+{
+	struct Road
+	{
+		std::uint32_t source;
+		std::uint32_t destination;
+	};
+
+	struct ExternalCountry
+	{
+		std::string path;
+		unsigned int numberOfTowns;
+		unsigned int source;
+		std::uint64_t numberOfRoads;
+		std::vector<std::uint32_t> blockFirstSources;	// The source of the first road of every block in the file
+	};
+
+	// Error Messages
+	constexpr auto FILE_FAILED = "Failed to access a country file!";
+	constexpr auto BUDGET_TOO_SMALL = "The memory budget is too small for the visited towns!";
+	constexpr auto NO_TEMPORARY_DIRECTORY = "Failed to find a directory for temporary files!";
+
+	// Consts
+	constexpr size_t ROADS_PER_BLOCK = 1 << 16;
+	constexpr size_t MIN_MERGE_BUFFER_SIZE = 1024;	// Roads, 8KB
+	constexpr size_t MAX_RUNS_PER_MERGE = 64;
+
+	namespace details
+	{
+		class RoadReader
+		{
+		public:
+			// Constructors
+			RoadReader(const std::string& path, size_t bufferSize) : file(path, std::ios::binary), buffer(std::max<size_t>(bufferSize, 1)), index(0), count(0)
+			{
+				if (!file) throw FILE_FAILED;
+			}
+
+			// Reading
+			bool Next(Road& road)
+			{
+				if (index == count)
+				{
+					file.read(reinterpret_cast<char*>(buffer.data()), buffer.size() * sizeof(Road));
+					count = static_cast<size_t>(file.gcount()) / sizeof(Road);
+					index = 0;
+
+					if (count == 0) return false;
+				}
+
+				road = buffer[index++];
+				return true;
+			}
+
+		private:
+			// Data Members
+			std::ifstream file;
+			std::vector<Road> buffer;
+			size_t index;
+			size_t count;
+		};
+
+		inline void WriteRoads(std::ofstream& file, const std::vector<Road>& roads, size_t count)
+		{
+			file.write(reinterpret_cast<const char*>(roads.data()), count * sizeof(Road));
+			if (!file) throw FILE_FAILED;
+		}
+
+		inline auto GetRunPath(const std::string& path, size_t run) { return path + ".run" + std::to_string(run); }
+
+		// Whether any of the towns from 'first' to 'last' is in the bitmap
+		inline bool HasAnyTown(const std::vector<std::uint64_t>& towns, std::uint64_t first, std::uint64_t last)
+		{
+			const auto firstWord = first / 64, lastWord = last / 64;
+			const auto firstMask = ~std::uint64_t(0) << (first % 64);
+			const auto lastMask = ~std::uint64_t(0) >> (63 - last % 64);
+
+			if (firstWord == lastWord) return (towns[firstWord] & firstMask & lastMask) != 0;
+			if (towns[firstWord] & firstMask) return true;
+			for (auto word = firstWord + 1; word < lastWord; word++)
+			{
+				if (towns[word] != 0) return true;
+			}
+
+			return (towns[lastWord] & lastMask) != 0;
+		}
+
+		inline void RemoveRuns(const std::string& path, const std::vector<size_t>& runs)
+		{
+			for (const auto run : runs) std::remove(GetRunPath(path, run).c_str());
+		}
+
+		// Merges the sorted runs into 'output', every reader and the writer get 'bufferSize' roads.
+		// Ties go to the earlier run, so the roads of every town keep their input order.
+		template<typename OnRoad>
+		void MergeRuns(const std::string& path, const std::vector<size_t>& runs, std::ofstream& output, size_t bufferSize, OnRoad&& onRoad)
+		{
+			std::vector<RoadReader> readers;
+			readers.reserve(runs.size());
+			for (const auto run : runs) readers.emplace_back(GetRunPath(path, run), bufferSize);
+
+			using Head = std::pair<Road, size_t>;
+			auto isAfter = [](const Head& first, const Head& second)
+			{
+				return first.first.source != second.first.source ? first.first.source > second.first.source : first.second > second.second;
+			};
+			std::priority_queue<Head, std::vector<Head>, decltype(isAfter)> heads(isAfter);
+
+			for (size_t index = 0; index < readers.size(); index++)
+			{
+				Road road;
+				if (readers[index].Next(road)) heads.push({ road, index });
+			}
+
+			std::vector<Road> buffer(std::max<size_t>(bufferSize, 1));
+			size_t buffered = 0;
+
+			while (!heads.empty())
+			{
+				const auto head = heads.top();
+				heads.pop();
+
+				onRoad(head.first);
+				buffer[buffered++] = head.first;
+				if (buffered == buffer.size())
+				{
+					WriteRoads(output, buffer, buffered);
+					buffered = 0;
+				}
+
+				Road road;
+				if (readers[head.second].Next(road)) heads.push({ road, head.second });
+			}
+
+			WriteRoads(output, buffer, buffered);
+		}
+	}
+
+	// Reads the user input format from 'input' straight into a sorted road file at 'path', using at most 'memoryBudget' bytes.
+	// The roads are sorted in runs that fit the budget, and the runs are merged a few at a time, so every reader
+	// keeps a buffer of at least MIN_MERGE_BUFFER_SIZE roads and only a bounded number of files is ever open.
+	// The run files are removed on every way out, and so is the road file when creating it fails.
+	inline auto CreateExternalCountry(std::istream& input, const std::string& path, size_t memoryBudget)
+	{
+		ExternalCountry country = { path, 0, 0, 0, {} };
+
+		// The input is checked by the same reader as the regular one, so both accept exactly the same input
+		UserInputReader reader(input);
+
+		// Sort the roads in runs that fit the budget
+		const auto runCapacity = std::max<size_t>(memoryBudget / sizeof(Road), 1);
+		std::vector<Road> run;
+		std::vector<size_t> runs;
+		size_t numberOfRunFiles = 0;
+
+		try
+		{
+			run.reserve(static_cast<size_t>(std::min<std::uint64_t>(reader.GetNumberOfPairs(), runCapacity)));
+
+			auto flushRun = [&]()
+			{
+				std::stable_sort(run.begin(), run.end(), [](const Road& first, const Road& second) { return first.source < second.source; });
+				runs.push_back(numberOfRunFiles++);
+				std::ofstream runFile(details::GetRunPath(path, runs.back()), std::ios::binary);
+				details::WriteRoads(runFile, run, run.size());
+				run.clear();
+			};
+
+			// The pairs are read one by one, since the whole line might not fit in memory
+			UserInput::Pair pair;
+			while (reader.ReadPair(pair))
+			{
+				run.push_back({ pair.source - 1, pair.destination - 1 });
+				if (run.size() == runCapacity) flushRun();
+			}
+
+			if (!run.empty()) flushRun();
+			run = std::vector<Road>();
+
+			country.source = reader.ReadSource();
+			country.numberOfTowns = reader.GetNumberOfTowns();
+			country.numberOfRoads = reader.GetNumberOfPairs();
+
+			// The budget is split between the readers of the merged runs and the writer. The runs are merged in order,
+			// so a merged run still keeps the roads of every town in their input order.
+			const auto runsPerMerge = std::min<size_t>(std::max<size_t>(runCapacity / MIN_MERGE_BUFFER_SIZE, 3) - 1, MAX_RUNS_PER_MERGE);
+			const auto bufferSize = runCapacity / (runsPerMerge + 1);
+
+			while (runs.size() > runsPerMerge)
+			{
+				std::vector<size_t> mergedRuns;
+				for (size_t first = 0; first < runs.size(); first += runsPerMerge)
+				{
+					const std::vector<size_t> group(runs.begin() + first, runs.begin() + std::min(first + runsPerMerge, runs.size()));
+					mergedRuns.push_back(numberOfRunFiles++);
+
+					std::ofstream mergedFile(details::GetRunPath(path, mergedRuns.back()), std::ios::binary);
+					details::MergeRuns(path, group, mergedFile, bufferSize, [](const Road&) {});
+					details::RemoveRuns(path, group);
+				}
+
+				runs.swap(mergedRuns);
+			}
+
+			std::ofstream file(path, std::ios::binary);
+			std::uint64_t written = 0;
+			details::MergeRuns(path, runs, file, bufferSize, [&](const Road& road)
+			{
+				if (written++ % ROADS_PER_BLOCK == 0) country.blockFirstSources.push_back(road.source);
+			});
+		}
+		catch (...)
+		{
+			// Every run file that was ever created goes, the ones that were already merged away are simply missing
+			for (size_t runFile = 0; runFile < numberOfRunFiles; runFile++) std::remove(details::GetRunPath(path, runFile).c_str());
+			std::remove(path.c_str());
+			throw;
+		}
+
+		details::RemoveRuns(path, runs);
+
+		return country;
+	}
+
+	// A path in the temporary directory that no other process, or other call in this one, gets
+	inline auto GetTemporaryPath(const std::string& name = "external-country", const std::string& extension = ".roads")
+	{
+		static std::atomic<unsigned int> counter(0);
+
+#ifdef _WIN32
+		const auto processId = _getpid();
+#else
+		const auto processId = getpid();
+#endif
+
+		std::error_code error;
+		const auto directory = std::filesystem::temp_directory_path(error);
+		if (error) throw NO_TEMPORARY_DIRECTORY;
+
+		const auto fileName = name + "-" + std::to_string(processId) + "-" + std::to_string(counter++) + extension;
+		return (directory / fileName).string();
+	}
+
+	inline void DeleteExternalCountry(const ExternalCountry& country)
+	{
+		std::remove(country.path.c_str());
+	}
+
+	// A bitmap of the towns that can be reached from 'townNumber' (zero based). The frontier is a bitmap as well, so the
+	// traversal needs the same memory however many towns a level reaches: three bitmaps and one block of roads.
+	inline auto GetToTown(const ExternalCountry& country, unsigned int townNumber, size_t memoryBudget)
+	{
+		const auto words = (static_cast<size_t>(country.numberOfTowns) + 63) / 64;
+		if (3 * words * sizeof(std::uint64_t) + ROADS_PER_BLOCK * sizeof(Road) > memoryBudget) throw BUDGET_TOO_SMALL;
+
+		std::vector<std::uint64_t> visited(words, 0);
+		std::vector<Road> block(ROADS_PER_BLOCK);
+
+		auto visit = [&visited](std::uint32_t town)
+		{
+			auto& word = visited[town / 64];
+			const auto bit = std::uint64_t(1) << (town % 64);
+			if (word & bit) return false;
+
+			word |= bit;
+			return true;
+		};
+
+		std::ifstream file(country.path, std::ios::binary);
+		if (!file) throw FILE_FAILED;
+
+		// Only the words from the first to the last word of a frontier can hold any of its towns,
+		// so a level that reaches few towns doesn't go over the whole bitmap
+		std::vector<std::uint64_t> frontier(words, 0);
+		std::vector<std::uint64_t> nextFrontier(words, 0);
+		size_t firstWord = townNumber / 64, lastWord = townNumber / 64;
+		size_t nextFirstWord = words, nextLastWord = 0;
+		frontier[townNumber / 64] |= std::uint64_t(1) << (townNumber % 64);
+		visit(townNumber);
+
+		auto isInFrontier = [&frontier](std::uint32_t town) { return (frontier[town / 64] >> (town % 64)) & 1; };
+
+		while (firstWord <= lastWord)
+		{
+			const std::uint64_t lastFrontierTown = lastWord * 64 + 63;
+
+			for (size_t blockIndex = 0; blockIndex < country.blockFirstSources.size(); blockIndex++)
+			{
+				// A block only holds roads from its first source up to the first source of the next block
+				const std::uint64_t firstSource = std::max<std::uint64_t>(country.blockFirstSources[blockIndex], firstWord * 64);
+				const std::uint64_t lastSource = std::min<std::uint64_t>(
+					blockIndex + 1 < country.blockFirstSources.size() ? country.blockFirstSources[blockIndex + 1] : UINT32_MAX, lastFrontierTown);
+				if (firstSource > lastFrontierTown) break;
+				if (firstSource > lastSource || !details::HasAnyTown(frontier, firstSource, lastSource)) continue;
+
+				file.clear();
+				file.seekg(static_cast<std::streamoff>(blockIndex * ROADS_PER_BLOCK * sizeof(Road)));
+				file.read(reinterpret_cast<char*>(block.data()), block.size() * sizeof(Road));
+				const auto count = static_cast<size_t>(file.gcount()) / sizeof(Road);
+
+				for (size_t index = 0; index < count && block[index].source <= lastFrontierTown; index++)
+				{
+					const auto& road = block[index];
+					if (isInFrontier(road.source) && visit(road.destination))
+					{
+						nextFrontier[road.destination / 64] |= std::uint64_t(1) << (road.destination % 64);
+						nextFirstWord = std::min<size_t>(nextFirstWord, road.destination / 64);
+						nextLastWord = std::max<size_t>(nextLastWord, road.destination / 64);
+					}
+				}
+			}
+
+			std::fill(frontier.begin() + firstWord, frontier.begin() + lastWord + 1, 0);
+			frontier.swap(nextFrontier);
+			firstWord = nextFirstWord;
+			lastWord = nextLastWord;
+			nextFirstWord = words;
+			nextLastWord = 0;
+		}
+
+		return visited;
+	}
+
+	// Prints the towns of the bitmap from the lowest to the highest
+	inline void PrintAccessibleTowns(const std::vector<std::uint64_t>& visited, std::ostream& output)
+	{
+		for (size_t word = 0; word < visited.size(); word++)
+		{
+			for (unsigned int bit = 0; bit < 64; bit++)
+			{
+				if (visited[word] & (std::uint64_t(1) << bit)) output << (word * 64 + bit + 1) << " ";
+			}
+		}
+
+		output << "\n";
+	}
+}
+
+#endif // !INCLUDE_COUNTRY_EXTERNALREACHABILITY__H
@@ -0,0 +1,271 @@
+#ifndef INCLUDE_COUNTRY_GENERATOR__H
+#define INCLUDE_COUNTRY_GENERATOR__H
+
+#include <cmath>
+#include <cstdint>
+#include <ostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "Country/Country.h"
+#include "Country/WeightedCountry.h"
+
+namespace generator
+{
+	// The kinds of countries we know how to generate. The number of roads is only used by RANDOM and POWER_LAW,
+	// the other shapes get as many roads as their shape needs.
+	enum class Shape
+	{
+		RANDOM,		// Every road connects two uniformly chosen towns
+		GRID,		// A road-like grid where every town is connected both ways to the towns around it (shuffled town numbers)
+		POWER_LAW,	// Few towns receive most of the roads
+		CHAIN,		// 1 -> 2 -> ... -> n, the worst case for the recursive traversal
+	};
+
+	inline auto ParseShape(const std::string& name)
+	{
+		if (name == "random") return Shape::RANDOM;
+		if (name == "grid") return Shape::GRID;
+		if (name == "powerlaw") return Shape::POWER_LAW;
+		if (name == "chain") return Shape::CHAIN;
+		throw "Unknown country shape! (expected random, grid, powerlaw or chain)";
+	}
+
+	// Every shape needs at least one town, the random shapes pick among them and a chain of none would have -1 roads
+	inline void CheckNumberOfTowns(std::uint64_t numberOfTowns)
+	{
+		if (numberOfTowns == 0 || numberOfTowns > UINT32_MAX) throw "The number of towns must be between 1 and 4294967295!";
+	}
+
+	inline auto ParseNumberOfTowns(const std::string& text)
+	{
+		const auto numberOfTowns = std::stoull(text);
+		CheckNumberOfTowns(numberOfTowns);
+
+		return static_cast<unsigned int>(numberOfTowns);
+	}
+
+	// std::mt19937_64 is fully specified by the standard while the distributions aren't,
+	// so we do the distributions ourselves to get the same country from the same seed everywhere.
+	class Random
+	{
+	public:
+		// Constructors
+		Random(std::uint64_t seed) : engine(seed) {}
+
+		// Getters
+		inline auto Below(std::uint64_t bound) { return engine() % bound; }
+		inline auto Unit() { return (engine() >> 11) * (1.0 / 9007199254740992.0); }
+
+	private:
+		// Data Members
+		std::mt19937_64 engine;
+	};
+
+	inline auto GetGridWidth(unsigned int numberOfTowns)
+	{
+		auto width = static_cast<unsigned int>(std::sqrt(static_cast<double>(numberOfTowns)));
+		while (width > 1 && static_cast<std::uint64_t>(width) * width > numberOfTowns) --width;
+		while (static_cast<std::uint64_t>(width + 1) * (width + 1) <= numberOfTowns) ++width;
+
+		return width == 0 ? 1u : width;
+	}
+
+	inline std::uint64_t GetNumberOfRoads(Shape shape, unsigned int numberOfTowns, std::uint64_t numberOfRoads)
+	{
+		CheckNumberOfTowns(numberOfTowns);
+		if (shape == Shape::CHAIN) return numberOfTowns - 1;
+		if (shape != Shape::GRID) return numberOfRoads;
+
+		// The last row of the grid might not be full
+		const std::uint64_t width = GetGridWidth(numberOfTowns);
+		const auto lastRowTowns = numberOfTowns % width;
+		const auto horizontalRoads = (numberOfTowns / width) * (width - 1) + (lastRowTowns > 0 ? lastRowTowns - 1 : 0);
+		const auto verticalRoads = numberOfTowns - width;
+
+		return 2 * (horizontalRoads + verticalRoads);
+	}
+
+	// Calls 'onRoad(source, destination)' (1-based, like the user input) for every road of the country
+	template<typename OnRoad>
+	void GenerateRoads(Shape shape, unsigned int numberOfTowns, std::uint64_t numberOfRoads, std::uint64_t seed, OnRoad&& onRoad)
+	{
+		CheckNumberOfTowns(numberOfTowns);
+		Random random(seed);
+
+		if (shape == Shape::RANDOM)
+		{
+			for (std::uint64_t road = 0; road < numberOfRoads; road++)
+			{
+				const auto source = static_cast<unsigned int>(random.Below(numberOfTowns)) + 1;
+				onRoad(source, static_cast<unsigned int>(random.Below(numberOfTowns)) + 1);
+			}
+		}
+		else if (shape == Shape::POWER_LAW)
+		{
+			// Cubing a uniform number piles the destinations up near the first towns
+			for (std::uint64_t road = 0; road < numberOfRoads; road++)
+			{
+				const auto source = static_cast<unsigned int>(random.Below(numberOfTowns)) + 1;
+				const auto unit = random.Unit();
+				onRoad(source, static_cast<unsigned int>(numberOfTowns * unit * unit * unit) + 1);
+			}
+		}
+		else if (shape == Shape::CHAIN)
+		{
+			for (unsigned int town = 1; town < numberOfTowns; town++)
+			{
+				onRoad(town, town + 1);
+			}
+		}
+		else
+		{
+			std::vector<unsigned int> labels(numberOfTowns);
+			for (unsigned int town = 0; town < numberOfTowns; town++)
+			{
+				labels[town] = town + 1;
+			}
+
+			for (auto town = numberOfTowns; town > 1; town--)
+			{
+				std::swap(labels[town - 1], labels[static_cast<unsigned int>(random.Below(town))]);
+			}
+
+			const auto width = GetGridWidth(numberOfTowns);
+			for (unsigned int town = 0; town < numberOfTowns; town++)
+			{
+				if ((town + 1) % width != 0 && town + 1 < numberOfTowns)
+				{
+					onRoad(labels[town], labels[town + 1]);
+					onRoad(labels[town + 1], labels[town]);
+				}
+
+				if (static_cast<std::uint64_t>(town) + width < numberOfTowns)
+				{
+					onRoad(labels[town], labels[town + width]);
+					onRoad(labels[town + width], labels[town]);
+				}
+			}
+		}
+	}
+
+	// The weights come from their own generator, so a weighted country has exactly the roads of the unweighted one
+	class WeightGenerator
+	{
+	public:
+		// Constructors
+		WeightGenerator(std::uint64_t seed, unsigned int maxWeight) : random(~seed), maxWeight(maxWeight) {}
+
+		// Getters
+		inline auto Next() { return static_cast<unsigned int>(random.Below(maxWeight)) + 1; }
+
+	private:
+		// Data Members
+		Random random;
+		unsigned int maxWeight;
+	};
+
+	// Writes the country in the format that 'GetUserInput' reads. Everything goes through one reused buffer,
+	// so countries with hundreds of millions of roads never have to be held in memory.
+	// With a 'maxWeight' the roads get weights from 1 to 'maxWeight', in the format that 'GetWeightedUserInput' reads.
+	inline void WriteCountry(std::ostream& output,
+							 Shape shape,
+							 unsigned int numberOfTowns,
+							 std::uint64_t numberOfRoads,
+							 std::uint64_t seed,
+							 unsigned int source = 1,
+							 unsigned int maxWeight = 0,
+							 unsigned int destination = NO_DESTINATION)
+	{
+		constexpr size_t FLUSH_SIZE = 1 << 16;
+		std::string buffer;
+		buffer.reserve(FLUSH_SIZE + 64);
+
+		auto appendNumber = [&buffer](std::uint64_t number, char separator)
+		{
+			char digits[20];
+			int length = 0;
+			do
+			{
+				digits[length++] = static_cast<char>('0' + number % 10);
+				number /= 10;
+			} while (number != 0);
+
+			while (length > 0) buffer.push_back(digits[--length]);
+			buffer.push_back(separator);
+		};
+
+		auto flush = [&output, &buffer]()
+		{
+			output.write(buffer.data(), buffer.size());
+			buffer.clear();
+		};
+
+		appendNumber(numberOfTowns, ' ');
+		appendNumber(GetNumberOfRoads(shape, numberOfTowns, numberOfRoads), '\n');
+
+		WeightGenerator weights(seed, maxWeight);
+		GenerateRoads(shape, numberOfTowns, numberOfRoads, seed, [&](unsigned int roadSource, unsigned int roadDestination)
+		{
+			appendNumber(roadSource, ' ');
+			appendNumber(roadDestination, ' ');
+			if (maxWeight != 0) appendNumber(weights.Next(), ' ');
+			if (buffer.size() >= FLUSH_SIZE) flush();
+		});
+
+		buffer.push_back('\n');
+		if (maxWeight == 0)
+		{
+			appendNumber(source, '\n');
+		}
+		else
+		{
+			appendNumber(source, ' ');
+			appendNumber(destination, '\n');
+		}
+
+		flush();
+	}
+
+	// Same as 'WriteCountry', but skips the text and builds the input directly
+	inline auto GenerateUserInput(Shape shape,
+								  unsigned int numberOfTowns,
+								  std::uint64_t numberOfRoads,
+								  std::uint64_t seed,
+								  unsigned int source = 1)
+	{
+		UserInput userInput = { numberOfTowns, {}, source };
+		userInput.pairs.reserve(GetNumberOfRoads(shape, numberOfTowns, numberOfRoads));
+
+		GenerateRoads(shape, numberOfTowns, numberOfRoads, seed, [&userInput](unsigned int roadSource, unsigned int roadDestination)
+		{
+			userInput.pairs.push_back({ roadSource, roadDestination });
+		});
+
+		return userInput;
+	}
+
+	inline auto GenerateWeightedUserInput(Shape shape,
+										  unsigned int numberOfTowns,
+										  std::uint64_t numberOfRoads,
+										  std::uint64_t seed,
+										  unsigned int maxWeight,
+										  unsigned int source = 1,
+										  unsigned int destination = NO_DESTINATION)
+	{
+		if (maxWeight == 0) throw "The maximum weight must be positive!";
+
+		WeightedUserInput userInput = { numberOfTowns, {}, source, destination };
+		userInput.roads.reserve(GetNumberOfRoads(shape, numberOfTowns, numberOfRoads));
+
+		WeightGenerator weights(seed, maxWeight);
+		GenerateRoads(shape, numberOfTowns, numberOfRoads, seed, [&](unsigned int roadSource, unsigned int roadDestination)
+		{
+			userInput.roads.push_back({ roadSource, roadDestination, weights.Next() });
+		});
+
+		return userInput;
+	}
+}
+
+#endif // !INCLUDE_COUNTRY_GENERATOR__H
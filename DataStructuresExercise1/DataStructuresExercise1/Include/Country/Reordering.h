@@ -0,0 +1,201 @@
+#ifndef INCLUDE_COUNTRY_REORDERING__H
+#define INCLUDE_COUNTRY_REORDERING__H
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+#include "Country/Country.h"
+
+namespace reordering
+{
+	// Town numbers come straight from the user, so the neighbors of a town are usually scattered all over
+	// 'coloredTowns' and the country vector. Relabeling the towns so that towns visited together get close
+	// numbers makes every traversal hop touch memory that is already in the cache.
+	enum class Strategy
+	{
+		NONE,
+		BFS,
+		REVERSE_CUTHILL_MCKEE,
+		DEGREE_SORTED
+	};
+
+	struct Relabeling
+	{
+		std::vector<unsigned int> newToOld;
+		std::vector<unsigned int> oldToNew;
+
+		inline auto ToNew(unsigned int oldTown) const { return oldToNew[oldTown]; }
+		inline auto ToOld(unsigned int newTown) const { return newToOld[newTown]; }
+	};
+
+	inline auto ParseStrategy(const std::string& name)
+	{
+		if (name == "none") return Strategy::NONE;
+		if (name == "bfs") return Strategy::BFS;
+		if (name == "rcm") return Strategy::REVERSE_CUTHILL_MCKEE;
+		if (name == "degree") return Strategy::DEGREE_SORTED;
+		throw "Unknown reordering strategy! (expected none, bfs, rcm or degree)";
+	}
+
+	inline auto GetStrategyName(Strategy strategy)
+	{
+		switch (strategy)
+		{
+		case Strategy::BFS: return "bfs";
+		case Strategy::REVERSE_CUTHILL_MCKEE: return "rcm";
+		case Strategy::DEGREE_SORTED: return "degree";
+		default: return "none";
+		}
+	}
+
+	inline auto GetIdentityRelabeling(unsigned int numberOfTowns)
+	{
+		Relabeling relabeling;
+		relabeling.newToOld.resize(numberOfTowns);
+		std::iota(relabeling.newToOld.begin(), relabeling.newToOld.end(), 0);
+		relabeling.oldToNew = relabeling.newToOld;
+
+		return relabeling;
+	}
+
+	// The number of roads going in and out of every town
+	template<typename CountryType>
+	auto GetDegrees(const CountryType& country)
+	{
+		std::vector<unsigned int> degrees(country.size(), 0);
+
+		for (unsigned int town = 0; town < country.size(); town++)
+		{
+			for (const auto& neighbor : country[town])
+			{
+				++degrees[town];
+				++degrees[neighbor];
+			}
+		}
+
+		return degrees;
+	}
+
+	// Visits every component in breadth first order, starting each one from the first town in 'roots' that wasn't visited yet.
+	// When 'byDegree' is set, the neighbors of every town are visited from the lowest degree to the highest (Cuthill-McKee).
+	template<typename CountryType>
+	auto GetBreadthFirstOrder(const CountryType& country,
+							  const std::vector<unsigned int>& roots,
+							  const std::vector<unsigned int>& degrees,
+							  bool byDegree)
+	{
+		std::vector<unsigned int> order;
+		order.reserve(country.size());
+		std::vector<Color> coloredTowns(country.size(), WHITE);
+
+		for (const auto& root : roots)
+		{
+			if (coloredTowns[root] != WHITE) continue;
+
+			coloredTowns[root] = BLACK;
+			order.push_back(root);
+
+			// 'order' doubles as the queue, everything after 'head' is still waiting to be expanded
+			for (size_t head = order.size() - 1; head < order.size(); head++)
+			{
+				const auto levelStart = order.size();
+
+				for (const auto& neighbor : country[order[head]])
+				{
+					if (coloredTowns[neighbor] == WHITE)
+					{
+						coloredTowns[neighbor] = BLACK;
+						order.push_back(neighbor);
+					}
+				}
+
+				if (byDegree)
+				{
+					std::stable_sort(order.begin() + levelStart, order.end(), [&degrees](unsigned int first, unsigned int second)
+					{
+						return degrees[first] < degrees[second];
+					});
+				}
+			}
+		}
+
+		return order;
+	}
+
+	template<typename CountryType>
+	auto ComputeRelabeling(const CountryType& country, Strategy strategy)
+	{
+		Relabeling relabeling;
+		relabeling.newToOld.resize(country.size());
+		std::iota(relabeling.newToOld.begin(), relabeling.newToOld.end(), 0);
+
+		if (strategy == Strategy::BFS)
+		{
+			relabeling.newToOld = GetBreadthFirstOrder(country, relabeling.newToOld, {}, false);
+		}
+		else if (strategy != Strategy::NONE)
+		{
+			const auto degrees = GetDegrees(country);
+			auto byDegree = [&degrees](unsigned int first, unsigned int second) { return degrees[first] < degrees[second]; };
+
+			if (strategy == Strategy::REVERSE_CUTHILL_MCKEE)
+			{
+				// Every component starts from its lowest degree town, and the whole order is reversed at the end
+				std::stable_sort(relabeling.newToOld.begin(), relabeling.newToOld.end(), byDegree);
+				relabeling.newToOld = GetBreadthFirstOrder(country, relabeling.newToOld, degrees, true);
+				std::reverse(relabeling.newToOld.begin(), relabeling.newToOld.end());
+			}
+			else
+			{
+				// The busiest towns are packed together at the start, where they stay hot in the cache
+				std::stable_sort(relabeling.newToOld.begin(), relabeling.newToOld.end(), [&byDegree](unsigned int first, unsigned int second)
+				{
+					return byDegree(second, first);
+				});
+			}
+		}
+
+		relabeling.oldToNew.resize(country.size());
+		for (unsigned int newTown = 0; newTown < relabeling.newToOld.size(); newTown++)
+		{
+			relabeling.oldToNew[relabeling.newToOld[newTown]] = newTown;
+		}
+
+		return relabeling;
+	}
+
+	// Rebuilds the country with the new town numbers. The towns are rebuilt in their new order, so their roads
+	// are also allocated next to each other. The order of the roads of every town is kept, which means that
+	// the traversals visit the same towns in the same order as they would on the original country.
+	template<typename CountryType>
+	auto Relabel(const CountryType& country, const Relabeling& relabeling)
+	{
+		CountryType relabeled(country.size());
+
+		for (unsigned int newTown = 0; newTown < country.size(); newTown++)
+		{
+			for (const auto& neighbor : country[relabeling.ToOld(newTown)])
+			{
+				relabeled[newTown].Append(relabeling.ToNew(neighbor));
+			}
+		}
+
+		return relabeled;
+	}
+
+	template<typename Allocator>
+	auto RestoreOriginalTowns(const containers::LinkedListArray<unsigned int, Allocator>& towns, const Relabeling& relabeling)
+	{
+		containers::LinkedListArray<unsigned int, Allocator> originalTowns(towns.Capacity(), towns.GetAllocator());
+
+		for (const auto& town : towns)
+		{
+			originalTowns.Append(relabeling.ToOld(town));
+		}
+
+		return originalTowns;
+	}
+}
+
+#endif // !INCLUDE_COUNTRY_REORDERING__H
@@ -0,0 +1,158 @@
+#ifndef INCLUDE_COUNTRY_SHORTESTPATHS__H
+#define INCLUDE_COUNTRY_SHORTESTPATHS__H
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Country/WeightedCountry.h"
+#include "DataStructures/DaryHeap.h"
+#include "DataStructures/RadixHeap.h"
+
+// The cheapest travel cost from a source town, by Dijkstra's algorithm. The towns are zero based, and every
+// 'GetCosts' returns the cost of reaching every town (UNREACHABLE when there's no route).
+// When a target is given the search stops as soon as the target's cost is final, so only that cost is exact.
+namespace dijkstra
+{
+	enum class Heap
+	{
+		DARY,	// A 4-ary heap with decrease key
+		RADIX,	// A monotone radix heap on the integer costs
+		NAIVE,	// std::priority_queue, stale entries are skipped when popped
+	};
+
+	// Consts
+	constexpr auto UNREACHABLE = std::numeric_limits<std::uint64_t>::max();
+	constexpr auto ALL_TOWNS = std::numeric_limits<unsigned int>::max();
+
+	inline auto ParseHeap(const std::string& name)
+	{
+		if (name == "dary") return Heap::DARY;
+		if (name == "radix") return Heap::RADIX;
+		if (name == "naive") return Heap::NAIVE;
+
+		throw "Unknown heap! (expected dary, radix or naive)";
+	}
+
+	inline auto GetHeapName(Heap heap)
+	{
+		switch (heap)
+		{
+		case Heap::DARY: return "dary";
+		case Heap::RADIX: return "radix";
+		default: return "naive";
+		}
+	}
+
+	template<typename CountryType>
+	auto GetCostsWithDaryHeap(const CountryType& country, unsigned int source, unsigned int target = ALL_TOWNS)
+	{
+		std::vector<std::uint64_t> costs(country.size(), UNREACHABLE);
+		containers::IndexedDaryHeap<std::uint64_t> heap(country.size());
+
+		costs[source] = 0;
+		heap.Push(source, 0);
+
+		while (!heap.IsEmpty())
+		{
+			const auto town = heap.Pop();
+			if (town == target) break;
+
+			// Every town is in the heap at most once, so nothing that's popped is stale
+			for (const auto& road : country[town])
+			{
+				const auto cost = costs[town] + road.weight;
+				if (cost < costs[road.destination])
+				{
+					costs[road.destination] = cost;
+					heap.PushOrDecreaseKey(road.destination, cost);
+				}
+			}
+		}
+
+		return costs;
+	}
+
+	template<typename CountryType>
+	auto GetCostsWithRadixHeap(const CountryType& country, unsigned int source, unsigned int target = ALL_TOWNS)
+	{
+		std::vector<std::uint64_t> costs(country.size(), UNREACHABLE);
+		containers::RadixHeap<unsigned int> heap;
+
+		costs[source] = 0;
+		heap.Push(0, source);
+
+		while (!heap.IsEmpty())
+		{
+			const auto entry = heap.Pop();
+			const auto town = entry.second;
+
+			// A town is pushed again whenever its cost drops, the entries with its older costs are skipped
+			if (entry.first != costs[town]) continue;
+			if (town == target) break;
+
+			for (const auto& road : country[town])
+			{
+				const auto cost = entry.first + road.weight;
+				if (cost < costs[road.destination])
+				{
+					costs[road.destination] = cost;
+					heap.Push(cost, road.destination);
+				}
+			}
+		}
+
+		return costs;
+	}
+
+	// The textbook version, kept as the baseline for the benchmark
+	template<typename CountryType>
+	auto GetCostsWithNaiveHeap(const CountryType& country, unsigned int source, unsigned int target = ALL_TOWNS)
+	{
+		using Entry = std::pair<std::uint64_t, unsigned int>;
+
+		std::vector<std::uint64_t> costs(country.size(), UNREACHABLE);
+		std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+
+		costs[source] = 0;
+		heap.push({ 0, source });
+
+		while (!heap.empty())
+		{
+			const auto entry = heap.top();
+			heap.pop();
+
+			const auto town = entry.second;
+			if (entry.first != costs[town]) continue;
+			if (town == target) break;
+
+			for (const auto& road : country[town])
+			{
+				const auto cost = entry.first + road.weight;
+				if (cost < costs[road.destination])
+				{
+					costs[road.destination] = cost;
+					heap.push({ cost, road.destination });
+				}
+			}
+		}
+
+		return costs;
+	}
+
+	template<typename CountryType>
+	auto GetCosts(const CountryType& country, unsigned int source, unsigned int target, Heap heap)
+	{
+		switch (heap)
+		{
+		case Heap::DARY: return GetCostsWithDaryHeap(country, source, target);
+		case Heap::RADIX: return GetCostsWithRadixHeap(country, source, target);
+		default: return GetCostsWithNaiveHeap(country, source, target);
+		}
+	}
+}
+
+#endif // !INCLUDE_COUNTRY_SHORTESTPATHS__H
@@ -0,0 +1,152 @@
+#ifndef INCLUDE_COUNTRY_USERIO__H
+#define INCLUDE_COUNTRY_USERIO__H
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "Country/Country.h"
+#include "Country/WeightedCountry.h"
+
+template<typename Allocator>
+void PrintAccessibleTowns(const containers::LinkedListArray<unsigned int, Allocator>& accessibleTowns, std::ostream& output = std::cout)
+{
+	for (const auto& accessibleTown : accessibleTowns)
+	{
+		output << (accessibleTown + 1) << " ";
+	}
+
+	output << "\n";
+}
+
+// Reads the user input one piece at a time, so the pairs can go straight to wherever they're kept (memory or a file).
+// Every reader of the format goes through it, so they all accept exactly the same input.
+// The college wanted us to first receive all of the input and then check for validity, so only 'ReadSource' throws.
+class UserInputReader
+{
+public:
+	// Constructors
+	// Gets the number of towns and the number of pairs seperated by a space
+	explicit UserInputReader(std::istream& input) : input(input)
+	{
+		input >> numberOfTowns >> numberOfPairs;
+		wasInvalid = input.fail() || numberOfTowns <= 0 || numberOfTowns > UINT32_MAX || numberOfPairs < 0;
+	}
+
+	// Getters
+	inline auto IsValid() const { return !wasInvalid; }
+	inline auto GetNumberOfTowns() const { return wasInvalid ? 0u : static_cast<unsigned int>(numberOfTowns); }
+	inline auto GetNumberOfPairs() const { return wasInvalid ? std::uint64_t(0) : static_cast<std::uint64_t>(numberOfPairs); }
+
+	// Methods
+	// Reads the next pair (1 based), and returns false instead when it's wrong or when all of the pairs were read
+	auto ReadPair(UserInput::Pair& pair)
+	{
+		if (wasInvalid || pairsRead == numberOfPairs) return false;
+
+		std::int64_t source;
+		std::int64_t destination;
+		input >> source >> destination;
+
+		wasInvalid = input.fail() || source <= 0 || source > numberOfTowns || destination <= 0 || destination > numberOfTowns;
+		if (wasInvalid) return false;
+
+		pair = { static_cast<unsigned int>(source), static_cast<unsigned int>(destination) };
+		++pairsRead;
+
+		return true;
+	}
+
+	// Gets the source town after the last pair, and throws if anything in the input was wrong
+	auto ReadSource()
+	{
+		// The line of town connections has to end after the last pair, so extra towns aren't taken for the source
+		while (input.peek() == ' ' || input.peek() == '\t' || input.peek() == '\r') input.get();
+		wasInvalid = wasInvalid || pairsRead != numberOfPairs || input.peek() != '\n';
+
+		std::int64_t source;
+		input >> source;
+
+		if (wasInvalid || input.fail() || source > numberOfTowns || source <= 0) throw INVALID_INPUT;
+
+		return static_cast<unsigned int>(source);
+	}
+
+private:
+	// Error Messages
+	static constexpr auto INVALID_INPUT = "invalid input";
+
+	// Data Members
+	std::istream& input;
+	std::int64_t numberOfTowns = 0;
+	std::int64_t numberOfPairs = 0;
+	std::int64_t pairsRead = 0;
+	bool wasInvalid = false;
+};
+
+inline auto GetUserInput(std::istream& input = std::cin)
+{
+	UserInputReader reader(input);
+
+	// The pairs are read straight from the stream into place. A wrong count can't reserve more than a bounded amount up front.
+	constexpr std::uint64_t MAX_RESERVED_PAIRS = 1 << 24;
+	UserInput userInput = { reader.GetNumberOfTowns(), {}, 0 };
+	userInput.pairs.reserve(static_cast<size_t>(std::min(reader.GetNumberOfPairs(), MAX_RESERVED_PAIRS)));
+
+	UserInput::Pair pair;
+	while (reader.ReadPair(pair)) userInput.pairs.push_back(pair);
+
+	userInput.source = reader.ReadSource();
+
+	return userInput;
+}
+
+// The costs of the towns in order, with a '-' for the ones that can't be reached
+inline void PrintCosts(const std::vector<std::uint64_t>& costs, std::uint64_t unreachable, std::ostream& output = std::cout)
+{
+	for (const auto& cost : costs)
+	{
+		if (cost == unreachable) output << "- ";
+		else output << cost << " ";
+	}
+
+	output << "\n";
+}
+
+inline auto GetWeightedUserInput(std::istream& input = std::cin)
+{
+	std::int64_t numberOfTowns;
+	std::int64_t numberOfRoads;
+	input >> numberOfTowns >> numberOfRoads;
+	bool wasInvalid = input.fail() || numberOfTowns <= 0 || numberOfTowns > UINT32_MAX || numberOfRoads < 0;
+
+	WeightedUserInput userInput = { wasInvalid ? 0 : static_cast<unsigned int>(numberOfTowns), {}, 0, NO_DESTINATION };
+
+	// Like the regular input, everything is read before the validity is checked
+	for (std::int64_t road = 0; !wasInvalid && road < numberOfRoads; road++)
+	{
+		std::int64_t source;
+		std::int64_t destination;
+		std::int64_t weight;
+		input >> source >> destination >> weight;
+
+		wasInvalid = input.fail() || source <= 0 || source > numberOfTowns || destination <= 0 || destination > numberOfTowns ||
+					 weight < 0 || weight > UINT32_MAX;
+
+		userInput.roads.push_back({ static_cast<unsigned int>(source), static_cast<unsigned int>(destination), static_cast<unsigned int>(weight) });
+	}
+
+	std::int64_t source;
+	std::int64_t destination;
+	input >> source >> destination;
+
+	if (wasInvalid || input.fail() || source <= 0 || source > numberOfTowns || destination < 0 || destination > numberOfTowns) throw "invalid input";
+
+	userInput.source = static_cast<unsigned int>(source);
+	userInput.destination = static_cast<unsigned int>(destination);
+
+	return userInput;
+}
+
+#endif // !INCLUDE_COUNTRY_USERIO__H
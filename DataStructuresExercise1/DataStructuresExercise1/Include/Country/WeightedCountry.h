@@ -0,0 +1,52 @@
+#ifndef INCLUDE_COUNTRY_WEIGHTEDCOUNTRY__H
+#define INCLUDE_COUNTRY_WEIGHTEDCOUNTRY__H
+
+#include <vector>
+#include "DataStructures/SmallList.h"
+
+// Countries whose roads have a travel cost. The input is the same as the regular one, except that every road is a
+// (source, destination, weight) triple, and the last line holds the destination town after the source one
+// (0 asks for the costs to all the towns).
+constexpr unsigned int NO_DESTINATION = 0;
+
+struct WeightedUserInput
+{
+	struct Road
+	{
+		unsigned int source;
+		unsigned int destination;
+		unsigned int weight;
+	};
+
+	unsigned int numberOfTowns;
+	std::vector<Road> roads;
+	unsigned int source;
+	unsigned int destination;
+};
+
+struct WeightedRoad
+{
+	unsigned int destination;
+	unsigned int weight;
+};
+
+// The roads of every town are contiguous, which is what the priority queues of the shortest path engine want
+using WeightedCountry = std::vector<containers::SmallList<WeightedRoad>>;
+
+inline auto GetWeightedCountryFromUserInput(const WeightedUserInput& userInput)
+{
+	WeightedCountry country(userInput.numberOfTowns);
+
+	std::vector<unsigned int> degrees(userInput.numberOfTowns, 0);
+	for (const auto& road : userInput.roads) ++degrees[road.source - 1];
+	for (unsigned int town = 0; town < userInput.numberOfTowns; town++) country[town].Reserve(degrees[town]);
+
+	for (const auto& road : userInput.roads)
+	{
+		country[road.source - 1].Append(WeightedRoad{ road.destination - 1, road.weight });
+	}
+
+	return country;
+}
+
+#endif // !INCLUDE_COUNTRY_WEIGHTEDCOUNTRY__H
@@ -0,0 +1,260 @@
+#ifndef INCLUDE_DATASTRUCTURES_ADJACENCYARRAY__H
+#define INCLUDE_DATASTRUCTURES_ADJACENCYARRAY__H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace containers
+{
+	// The neighbors of all the vertices in a single array, where the neighbors of every vertex sit next to each other
+	// and 'offsets' tells where they start (compressed sparse rows). It's built from an edge list by a pool of workers:
+	// every worker counts the edges of its own share of the list, the counts are summed into the offsets,
+	// and every worker writes its edges to the places the sums saved for it. The workers always split the list
+	// in the same order, so the neighbors of a vertex keep the order of the list for any number of workers.
+	// Every worker counts the edges of every vertex, so there are never more workers than it takes for their counts
+	// to fill as much memory as the array itself.
+	class AdjacencyArray
+	{
+	public:
+		// Subclasses
+		class Neighbors
+		{
+			// Friend Classes
+			friend class AdjacencyArray;
+
+		private:
+			// Members
+			const std::uint32_t* first;
+			const std::uint32_t* last;
+
+			// C'tors
+			Neighbors(const std::uint32_t* first, const std::uint32_t* last) : first(first), last(last) {}
+
+		public:
+			// Getters
+			inline auto Size() const { return static_cast<std::uint32_t>(last - first); }
+			inline auto IsEmpty() const { return first == last; }
+			inline auto begin() const { return first; }
+			inline auto end() const { return last; }
+		};
+
+		// Constructors
+		AdjacencyArray() : offsets(1, 0), numberOfEdges(0) {}
+
+		// Builds the array from an edge list, 'getEdge(edge)' returns the zero based (source, destination) of every edge.
+		// With 'isSortedAndUnique', the neighbors of every vertex are also sorted and their duplicates removed.
+		template<typename Edges, typename GetEdge>
+		AdjacencyArray(size_t numberOfVertices, const Edges& edges, GetEdge getEdge, unsigned int numberOfWorkers = 1, bool isSortedAndUnique = false)
+			: offsets(numberOfVertices + 1, 0), numberOfEdges(edges.size())
+		{
+			numberOfWorkers = GetNumberOfCountingWorkers(numberOfVertices, edges.size(), numberOfWorkers);
+
+			// Every worker counts the edges of every vertex in its own share of the list
+			std::vector<std::vector<std::uint32_t>> counts(numberOfWorkers);
+			RunWorkers(numberOfWorkers, [&](unsigned int worker)
+			{
+				auto& workerCounts = counts[worker];
+				workerCounts.assign(numberOfVertices, 0);
+
+				const auto last = GetShareEnd(edges.size(), worker, numberOfWorkers);
+				for (auto edge = GetShareBegin(edges.size(), worker, numberOfWorkers); edge < last; edge++)
+				{
+					++workerCounts[getEdge(edges[edge]).first];
+				}
+			});
+
+			// The count of every worker becomes the number of edges of the vertex that come before its share,
+			// and the total is the degree of the vertex, which the scan turns into its offset
+			RunWorkers(numberOfWorkers, [&](unsigned int worker)
+			{
+				const auto last = GetShareEnd(numberOfVertices, worker, numberOfWorkers);
+				for (auto vertex = GetShareBegin(numberOfVertices, worker, numberOfWorkers); vertex < last; vertex++)
+				{
+					std::uint64_t degree = 0;
+					for (auto& workerCounts : counts)
+					{
+						const auto count = workerCounts[vertex];
+						workerCounts[vertex] = static_cast<std::uint32_t>(degree);
+						degree += count;
+					}
+
+					offsets[vertex] = degree;
+				}
+			});
+
+			ScanOffsets(offsets, numberOfVertices, numberOfWorkers);
+
+			// The array isn't zeroed, every one of its places is written exactly once by the workers
+			neighbors.reset(new std::uint32_t[numberOfEdges]);
+			RunWorkers(numberOfWorkers, [&](unsigned int worker)
+			{
+				auto& workerCounts = counts[worker];
+
+				const auto last = GetShareEnd(edges.size(), worker, numberOfWorkers);
+				for (auto edge = GetShareBegin(edges.size(), worker, numberOfWorkers); edge < last; edge++)
+				{
+					const auto sourceAndDestination = getEdge(edges[edge]);
+					neighbors[offsets[sourceAndDestination.first] + workerCounts[sourceAndDestination.first]++] = sourceAndDestination.second;
+				}
+
+				workerCounts = std::vector<std::uint32_t>();
+			});
+
+			if (isSortedAndUnique) SortAndUnique(numberOfWorkers);
+		}
+
+		// Getters
+		inline auto Size() const { return offsets.size() - 1; }
+		inline auto size() const { return Size(); }	// So it can stand in for the country vector
+		inline auto NumberOfEdges() const { return numberOfEdges; }
+		inline auto MemoryBytes() const { return numberOfEdges * sizeof(std::uint32_t) + offsets.capacity() * sizeof(std::uint64_t); }
+
+		inline auto operator[](size_t vertex) const
+		{
+			return Neighbors(neighbors.get() + offsets[vertex], neighbors.get() + offsets[vertex + 1]);
+		}
+
+	private:
+		// Data Members
+		std::vector<std::uint64_t> offsets;
+		std::unique_ptr<std::uint32_t[]> neighbors;
+		std::uint64_t numberOfEdges;
+
+		// Methods
+		// Worker 'worker' of 'numberOfWorkers' takes the items from GetShareBegin to GetShareEnd out of 'count'
+		static inline std::uint64_t GetShareBegin(std::uint64_t count, unsigned int worker, unsigned int numberOfWorkers)
+		{
+			return count / numberOfWorkers * worker + std::min<std::uint64_t>(count % numberOfWorkers, worker);
+		}
+
+		static inline std::uint64_t GetShareEnd(std::uint64_t count, unsigned int worker, unsigned int numberOfWorkers)
+		{
+			return GetShareBegin(count, worker + 1, numberOfWorkers);
+		}
+
+		// The counts of the workers (4 bytes per vertex each) take at most as much as the offsets and the neighbors
+		static unsigned int GetNumberOfCountingWorkers(std::uint64_t numberOfVertices, std::uint64_t numberOfEdges, unsigned int numberOfWorkers)
+		{
+			if (numberOfVertices == 0) return std::max(numberOfWorkers, 1u);
+
+			const auto affordable = 2 + numberOfEdges / numberOfVertices;
+			return static_cast<unsigned int>(std::max<std::uint64_t>(std::min<std::uint64_t>(numberOfWorkers, affordable), 1));
+		}
+
+		// Runs 'function(worker)' for every worker, the first one on the calling thread. Whatever fails (starting a thread
+		// or a worker), every thread that started is joined first, and then the first exception is rethrown.
+		template<typename Function>
+		static void RunWorkers(unsigned int numberOfWorkers, Function function)
+		{
+			std::vector<std::exception_ptr> failures(numberOfWorkers);
+			auto runWorker = [&function, &failures](unsigned int worker)
+			{
+				try { function(worker); }
+				catch (...) { failures[worker] = std::current_exception(); }
+			};
+
+			std::vector<std::thread> threads;
+			try
+			{
+				threads.reserve(numberOfWorkers - 1);
+				for (unsigned int worker = 1; worker < numberOfWorkers; worker++) threads.emplace_back(runWorker, worker);
+			}
+			catch (...)
+			{
+				for (auto& thread : threads) thread.join();
+				throw;
+			}
+
+			runWorker(0);
+			for (auto& thread : threads) thread.join();
+
+			for (const auto& failure : failures)
+			{
+				if (failure) std::rethrow_exception(failure);
+			}
+		}
+
+		// Turns the first 'count' values into the sums of the values before them, and puts the total after them.
+		// Every worker sums its share, the shares are scanned on the calling thread, and then every worker scans its share.
+		static void ScanOffsets(std::vector<std::uint64_t>& values, size_t count, unsigned int numberOfWorkers)
+		{
+			std::vector<std::uint64_t> shareStarts(numberOfWorkers + 1, 0);
+			RunWorkers(numberOfWorkers, [&](unsigned int worker)
+			{
+				std::uint64_t sum = 0;
+				const auto last = GetShareEnd(count, worker, numberOfWorkers);
+				for (auto index = GetShareBegin(count, worker, numberOfWorkers); index < last; index++) sum += values[index];
+
+				shareStarts[worker + 1] = sum;
+			});
+
+			for (unsigned int worker = 0; worker < numberOfWorkers; worker++) shareStarts[worker + 1] += shareStarts[worker];
+
+			RunWorkers(numberOfWorkers, [&](unsigned int worker)
+			{
+				auto sum = shareStarts[worker];
+				const auto last = GetShareEnd(count, worker, numberOfWorkers);
+				for (auto index = GetShareBegin(count, worker, numberOfWorkers); index < last; index++)
+				{
+					const auto value = values[index];
+					values[index] = sum;
+					sum += value;
+				}
+			});
+
+			values[count] = shareStarts[numberOfWorkers];
+		}
+
+		// The workers split the vertices by their edges rather than by their number, so a few huge vertices
+		// don't leave a single worker to sort most of the array
+		void SortAndUnique(unsigned int numberOfWorkers)
+		{
+			const auto numberOfVertices = Size();
+			if (numberOfVertices == 0) return;
+
+			std::vector<size_t> firstVertices(numberOfWorkers + 1, numberOfVertices);
+			for (unsigned int worker = 0; worker < numberOfWorkers; worker++)
+			{
+				const auto firstEdge = GetShareBegin(numberOfEdges, worker, numberOfWorkers);
+				firstVertices[worker] = static_cast<size_t>(std::upper_bound(offsets.begin(), offsets.end() - 1, firstEdge) - offsets.begin() - 1);
+			}
+
+			firstVertices[0] = 0;
+
+			std::vector<std::uint64_t> uniqueOffsets(numberOfVertices + 1, 0);
+			RunWorkers(numberOfWorkers, [&](unsigned int worker)
+			{
+				for (auto vertex = firstVertices[worker]; vertex < firstVertices[worker + 1]; vertex++)
+				{
+					const auto first = neighbors.get() + offsets[vertex];
+					const auto last = neighbors.get() + offsets[vertex + 1];
+					std::sort(first, last);
+					uniqueOffsets[vertex] = static_cast<std::uint64_t>(std::unique(first, last) - first);
+				}
+			});
+
+			ScanOffsets(uniqueOffsets, numberOfVertices, numberOfWorkers);
+
+			std::unique_ptr<std::uint32_t[]> uniqueNeighbors(new std::uint32_t[uniqueOffsets.back()]);
+			RunWorkers(numberOfWorkers, [&](unsigned int worker)
+			{
+				for (auto vertex = firstVertices[worker]; vertex < firstVertices[worker + 1]; vertex++)
+				{
+					const auto first = neighbors.get() + offsets[vertex];
+					std::copy(first, first + (uniqueOffsets[vertex + 1] - uniqueOffsets[vertex]), uniqueNeighbors.get() + uniqueOffsets[vertex]);
+				}
+			});
+
+			offsets = std::move(uniqueOffsets);
+			neighbors = std::move(uniqueNeighbors);
+			numberOfEdges = offsets.back();
+		}
+	};
+}
+
+#endif // !INCLUDE_DATASTRUCTURES_ADJACENCYARRAY__H
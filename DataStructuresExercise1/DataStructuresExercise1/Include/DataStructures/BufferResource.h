@@ -0,0 +1,56 @@
+#ifndef INCLUDE_DATASTRUCTURES_BUFFERRESOURCE__H
+#define INCLUDE_DATASTRUCTURES_BUFFERRESOURCE__H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+
+namespace containers
+{
+	namespace pmr
+	{
+		// Hands out a fixed buffer (usually on the stack) first, and everything that doesn't fit in it comes from 'upstream'.
+		// Unlike std::pmr::monotonic_buffer_resource, what came from 'upstream' goes back to it as soon as it's freed,
+		// so a pool upstream keeps only what's alive at once. The buffer itself is reused only when the resource goes away.
+		class BufferResource : public std::pmr::memory_resource
+		{
+		public:
+			// Constructors
+			BufferResource(void* buffer, std::size_t size, std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+				: first(static_cast<std::byte*>(buffer)), current(first), last(first + size), upstream(upstream) { }
+			BufferResource(const BufferResource& other) = delete;
+
+			// Assignment Operator Methods
+			BufferResource& operator=(const BufferResource& other) = delete;
+
+		private:
+			// Data Members
+			std::byte* first;
+			std::byte* current;
+			std::byte* last;
+			std::pmr::memory_resource* upstream;
+
+			// Methods
+			void* do_allocate(std::size_t bytes, std::size_t alignment) override
+			{
+				void* place = current;
+				auto space = static_cast<std::size_t>(last - current);
+				if (std::align(alignment, bytes, place, space) == nullptr) return upstream->allocate(bytes, alignment);
+
+				current = static_cast<std::byte*>(place) + bytes;
+				return place;
+			}
+
+			void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override
+			{
+				const std::less<const void*> isBefore;
+				if (isBefore(pointer, first) || !isBefore(pointer, last)) upstream->deallocate(pointer, bytes, alignment);
+			}
+
+			bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+		};
+	}
+}
+
+#endif // !INCLUDE_DATASTRUCTURES_BUFFERRESOURCE__H
@@ -0,0 +1,316 @@
+#ifndef INCLUDE_DATASTRUCTURES_COMPRESSEDADJACENCY__H
+#define INCLUDE_DATASTRUCTURES_COMPRESSEDADJACENCY__H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace containers
+{
+	namespace codecs
+	{
+		// Every value takes 7 bits per byte, the high bit says whether more bytes follow.
+		// Small gaps between sorted neighbors take a single byte.
+		struct Varint
+		{
+			static void Encode(std::vector<std::uint8_t>& bytes, const std::uint32_t* values, size_t count)
+			{
+				for (size_t index = 0; index < count; index++)
+				{
+					auto value = values[index];
+					while (value >= 0x80)
+					{
+						bytes.push_back(static_cast<std::uint8_t>(value | 0x80));
+						value >>= 7;
+					}
+
+					bytes.push_back(static_cast<std::uint8_t>(value));
+				}
+			}
+
+			class Decoder
+			{
+			public:
+				// C'tors
+				Decoder() : position(nullptr) {}
+				Decoder(const std::uint8_t* position, size_t) : position(position) {}
+
+				// Decoding
+				inline std::uint32_t Next()
+				{
+					std::uint32_t value = *position & 0x7F;
+					for (unsigned int shift = 7; *(position++) & 0x80; shift += 7)
+					{
+						value |= static_cast<std::uint32_t>(*position & 0x7F) << shift;
+					}
+
+					return value;
+				}
+
+			private:
+				// Members
+				const std::uint8_t* position;
+			};
+		};
+
+		// Values are stored in groups of four behind a single tag byte that holds the byte length of each of them.
+		// Decoding a group never branches on individual bytes, and the fixed layout maps to a single byte shuffle on SIMD hardware.
+		struct GroupVarint
+		{
+		private:
+			// Consts
+			static constexpr size_t GROUP_SIZE = 4;
+
+		public:
+			static void Encode(std::vector<std::uint8_t>& bytes, const std::uint32_t* values, size_t count)
+			{
+				for (size_t groupStart = 0; groupStart < count; groupStart += GROUP_SIZE)
+				{
+					const auto tagIndex = bytes.size();
+					std::uint8_t tag = 0;
+					bytes.push_back(tag);
+
+					for (size_t index = 0; index < GROUP_SIZE && groupStart + index < count; index++)
+					{
+						auto value = values[groupStart + index];
+						const unsigned int length = value < (1u << 8) ? 1 : value < (1u << 16) ? 2 : value < (1u << 24) ? 3 : 4;
+						tag |= static_cast<std::uint8_t>((length - 1) << (2 * index));
+
+						for (unsigned int byte = 0; byte < length; byte++, value >>= 8)
+						{
+							bytes.push_back(static_cast<std::uint8_t>(value));
+						}
+					}
+
+					bytes[tagIndex] = tag;
+				}
+			}
+
+			class Decoder
+			{
+			public:
+				// C'tors
+				Decoder() : position(nullptr), remaining(0), index(GROUP_SIZE) {}
+				Decoder(const std::uint8_t* position, size_t count) : position(position), remaining(count), index(GROUP_SIZE) {}
+
+				// Decoding
+				inline std::uint32_t Next()
+				{
+					if (index == GROUP_SIZE) DecodeGroup();
+					return values[index++];
+				}
+
+			private:
+				// Members
+				const std::uint8_t* position;
+				size_t remaining;
+				size_t index;
+				std::uint32_t values[GROUP_SIZE];
+
+				// Methods
+				void DecodeGroup()
+				{
+					const auto tag = *(position++);
+					const auto groupSize = remaining < GROUP_SIZE ? remaining : GROUP_SIZE;
+
+					for (size_t value = 0; value < groupSize; value++)
+					{
+						const unsigned int length = ((tag >> (2 * value)) & 3) + 1;
+						std::uint32_t decoded = 0;
+
+						for (unsigned int byte = 0; byte < length; byte++)
+						{
+							decoded |= static_cast<std::uint32_t>(position[byte]) << (8 * byte);
+						}
+
+						values[value] = decoded;
+						position += length;
+					}
+
+					remaining -= groupSize;
+					index = 0;
+				}
+			};
+		};
+	}
+
+	// An immutable adjacency structure for very large graphs. The neighbors of every vertex are sorted,
+	// deduplicated and stored as the gaps between them, compressed by 'Codec', one vertex after the other
+	// in a single byte array. The neighbors are decoded while iterating, so nothing is ever expanded in memory.
+	template<typename Codec = codecs::Varint>
+	class CompressedAdjacency
+	{
+	public:
+		// Subclasses
+		class NeighborIterator
+		{
+			// Friend Classes
+			friend class CompressedAdjacency;
+
+		private:
+			// Error Messages
+			static constexpr auto DEREFERENCED_INVALID_ITERATOR = "Can't dereference a dangling iterator!";
+			static constexpr auto INCREMENTED_INVALID_ITERATOR = "Can't increment a dangling iterator!";
+
+			// Members
+			typename Codec::Decoder decoder;
+			std::uint32_t remaining;
+			std::uint32_t current;
+
+			// C'tors
+			NeighborIterator(const std::uint8_t* position, std::uint32_t count) : decoder(position, count), remaining(count), current(0)
+			{
+				if (remaining != 0) current = decoder.Next();
+			}
+
+		public:
+			// C'tors
+			NeighborIterator() : remaining(0), current(0) {}
+
+			// Iterator Methods
+			inline const auto& operator*() const
+			{
+				if (remaining == 0) throw DEREFERENCED_INVALID_ITERATOR;
+				return current;
+			}
+
+			inline auto& operator++()
+			{
+				if (remaining == 0) throw INCREMENTED_INVALID_ITERATOR;
+				if (--remaining != 0) current += decoder.Next();
+				return *this;
+			}
+
+			auto operator++(int)
+			{
+				NeighborIterator before = *this;
+				++(*this);
+
+				return before;
+			}
+
+			// Iterators are only ever compared with iterators of the same vertex
+			inline auto operator!=(const NeighborIterator& other) const { return remaining != other.remaining; }
+			inline auto operator==(const NeighborIterator& other) const { return !(*this != other); }
+		};
+
+		class Neighbors
+		{
+			// Friend Classes
+			friend class CompressedAdjacency;
+
+		private:
+			// Members
+			const std::uint8_t* position;
+			std::uint32_t count;
+
+			// C'tors
+			Neighbors(const std::uint8_t* position, std::uint32_t count) : position(position), count(count) {}
+
+		public:
+			// Getters
+			inline auto Size() const { return count; }
+			inline auto IsEmpty() const { return count == 0; }
+			inline auto begin() const { return NeighborIterator(position, count); }
+			inline auto end() const { return NeighborIterator(); }
+		};
+
+		// Constructors
+		CompressedAdjacency() : offsets(1, 0), numberOfEdges(0) {}
+
+		// Compresses any indexable container of iterable neighbor lists (like the country vector)
+		template<typename Lists>
+		explicit CompressedAdjacency(const Lists& lists) : CompressedAdjacency()
+		{
+			offsets.reserve(lists.size() + 1);
+			std::vector<std::uint32_t> neighbors;
+
+			for (size_t vertex = 0; vertex < lists.size(); vertex++)
+			{
+				neighbors.clear();
+				for (const auto& neighbor : lists[vertex]) neighbors.push_back(neighbor);
+				AppendVertex(neighbors.data(), neighbors.data() + neighbors.size());
+			}
+
+			Shrink();
+		}
+
+		// Compresses an edge list, 'getEdge(edge)' returns the zero based (source, destination) of every edge.
+		// The edges are bucketed by source with a counting sort, so this takes 4 bytes per edge on top of the result.
+		template<typename Edges, typename GetEdge>
+		CompressedAdjacency(size_t numberOfVertices, const Edges& edges, GetEdge getEdge) : CompressedAdjacency()
+		{
+			std::vector<std::uint64_t> starts(numberOfVertices + 1, 0);
+			for (const auto& edge : edges) ++starts[getEdge(edge).first + 1];
+			for (size_t vertex = 0; vertex < numberOfVertices; vertex++) starts[vertex + 1] += starts[vertex];
+
+			std::vector<std::uint32_t> destinations(starts.back());
+			std::vector<std::uint64_t> fills(starts.begin(), starts.end() - 1);
+			for (const auto& edge : edges)
+			{
+				const auto sourceAndDestination = getEdge(edge);
+				destinations[fills[sourceAndDestination.first]++] = sourceAndDestination.second;
+			}
+
+			fills = std::vector<std::uint64_t>();
+			offsets.reserve(numberOfVertices + 1);
+
+			for (size_t vertex = 0; vertex < numberOfVertices; vertex++)
+			{
+				AppendVertex(destinations.data() + starts[vertex], destinations.data() + starts[vertex + 1]);
+			}
+
+			Shrink();
+		}
+
+		// Getters
+		inline auto Size() const { return offsets.size() - 1; }
+		inline auto size() const { return Size(); }	// So it can stand in for the country vector
+		inline auto NumberOfEdges() const { return numberOfEdges; }
+		inline auto MemoryBytes() const { return bytes.capacity() + offsets.capacity() * sizeof(std::uint64_t); }
+
+		inline auto operator[](size_t vertex) const
+		{
+			const auto* position = bytes.data() + offsets[vertex];
+			const auto count = codecs::Varint::Decoder(position, 1).Next();
+
+			// The count itself is a varint in front of the neighbors, skip its bytes
+			while (*(position++) & 0x80);
+
+			return Neighbors(position, count);
+		}
+
+	private:
+		// Data Members
+		std::vector<std::uint8_t> bytes;
+		std::vector<std::uint64_t> offsets;
+		std::uint64_t numberOfEdges;
+
+		// Methods
+		void AppendVertex(std::uint32_t* neighborsBegin, std::uint32_t* neighborsEnd)
+		{
+			std::sort(neighborsBegin, neighborsEnd);
+			neighborsEnd = std::unique(neighborsBegin, neighborsEnd);
+
+			const auto count = static_cast<std::uint32_t>(neighborsEnd - neighborsBegin);
+			for (auto index = count; index > 1; index--)
+			{
+				neighborsBegin[index - 1] -= neighborsBegin[index - 2];
+			}
+
+			codecs::Varint::Encode(bytes, &count, 1);
+			Codec::Encode(bytes, neighborsBegin, count);
+			offsets.push_back(bytes.size());
+			numberOfEdges += count;
+		}
+
+		void Shrink()
+		{
+			bytes.shrink_to_fit();
+			offsets.shrink_to_fit();
+		}
+	};
+}
+
+#endif // !INCLUDE_DATASTRUCTURES_COMPRESSEDADJACENCY__H
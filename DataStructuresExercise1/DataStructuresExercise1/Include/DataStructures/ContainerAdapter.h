@@ -0,0 +1,43 @@
+#ifndef INCLUDE_DATASTRUCTURES_CONTAINERADAPTER__H
+#define INCLUDE_DATASTRUCTURES_CONTAINERADAPTER__H
+
+#include <type_traits>
+
+namespace containers
+{
+	namespace details
+	{
+		template<typename Container, typename = void>
+		struct HasAllocator : std::false_type { };
+
+		template<typename Container>
+		struct HasAllocator<Container, std::void_t<typename Container::allocator_type>> : std::true_type { };
+
+		// The allocator of the adapter constructors that take one, which only exist when the container has one
+		template<typename Container>
+		using AllocatorOf = typename Container::allocator_type;
+
+		// The base of the stack and the queue. Only a container that allocates gives them an allocator_type and a GetAllocator.
+		template<typename Container, bool = HasAllocator<Container>::value>
+		class ContainerAdapter : protected Container
+		{
+		public:
+			using Container::Container;
+		};
+
+		template<typename Container>
+		class ContainerAdapter<Container, true> : protected Container
+		{
+		public:
+			// Types
+			using allocator_type = typename Container::allocator_type;
+
+			using Container::Container;
+
+			// Getters
+			inline auto GetAllocator() const { return Container::GetAllocator(); }
+		};
+	}
+}
+
+#endif // !INCLUDE_DATASTRUCTURES_CONTAINERADAPTER__H
@@ -0,0 +1,181 @@
+#ifndef INCLUDE_DATASTRUCTURES_DARYHEAP__H
+#define INCLUDE_DATASTRUCTURES_DARYHEAP__H
+
+#include <cstddef>
+#include <vector>
+
+namespace containers
+{
+	// A min heap of the ids 0..numberOfIds-1 ordered by their keys, with every node having 'Arity' children.
+	// A wider node makes the heap shallower, and its children sit next to each other in memory, so a pop touches
+	// fewer cache lines than it would in a binary heap. The position of every id in the heap is kept in an index map,
+	// which lets 'DecreaseKey' find the id in O(1) and sift it up in place instead of pushing it again.
+	template<typename KeyType, unsigned int Arity = 4>
+	class IndexedDaryHeap
+	{
+		static_assert(Arity >= 2, "A heap node needs at least two children!");
+
+	public:
+		// Constructors
+		explicit IndexedDaryHeap(size_t numberOfIds = 0) : positions(numberOfIds, NOT_IN_HEAP) { heap.reserve(numberOfIds); }
+
+		// Getters
+		inline auto Size() const { return heap.size(); }
+		inline auto IsEmpty() const { return heap.empty(); }
+		inline auto Contains(unsigned int id) const { return positions[id] != NOT_IN_HEAP; }
+		inline auto GetKey(unsigned int id) const
+		{
+			if (!Contains(id)) throw ID_NOT_IN_HEAP;
+			return heap[positions[id]].key;
+		}
+
+		inline auto Top() const
+		{
+			if (IsEmpty()) throw GET_TOP_WHEN_EMPTY;
+			return heap[0].id;
+		}
+
+		inline auto TopKey() const
+		{
+			if (IsEmpty()) throw GET_TOP_WHEN_EMPTY;
+			return heap[0].key;
+		}
+
+		// Heap Manipulation
+		auto& Push(unsigned int id, KeyType key)
+		{
+			if (Contains(id)) throw ID_ALREADY_IN_HEAP;
+
+			heap.push_back({ key, id });
+			positions[id] = static_cast<unsigned int>(heap.size() - 1);
+			SiftUp(heap.size() - 1);
+
+			return *this;
+		}
+
+		auto& DecreaseKey(unsigned int id, KeyType key)
+		{
+			if (!Contains(id)) throw ID_NOT_IN_HEAP;
+			if (heap[positions[id]].key < key) throw KEY_INCREASED;
+
+			heap[positions[id]].key = key;
+			SiftUp(positions[id]);
+
+			return *this;
+		}
+
+		// Pushes the id, or lowers its key when it's already in the heap with a higher one.
+		// Returns whether the key of the id changed.
+		bool PushOrDecreaseKey(unsigned int id, KeyType key)
+		{
+			if (!Contains(id)) Push(id, key);
+			else if (key < heap[positions[id]].key) DecreaseKey(id, key);
+			else return false;
+
+			return true;
+		}
+
+		auto Pop()
+		{
+			if (IsEmpty()) throw POP_WHEN_EMPTY;
+
+			const auto top = heap[0].id;
+			positions[top] = NOT_IN_HEAP;
+
+			if (heap.size() > 1)
+			{
+				heap[0] = heap.back();
+				positions[heap[0].id] = 0;
+				heap.pop_back();
+				SiftDown(0);
+			}
+			else
+			{
+				heap.pop_back();
+			}
+
+			return top;
+		}
+
+		auto& MakeEmpty()
+		{
+			for (const auto& entry : heap) positions[entry.id] = NOT_IN_HEAP;
+			heap.clear();
+
+			return *this;
+		}
+
+		auto& Clear() { return MakeEmpty(); }
+
+	private:
+		// Error Messages
+		static constexpr auto GET_TOP_WHEN_EMPTY = "Can't get the top of the heap when it's empty!";
+		static constexpr auto POP_WHEN_EMPTY = "Can't pop the heap when it's empty!";
+		static constexpr auto ID_NOT_IN_HEAP = "The id isn't in the heap!";
+		static constexpr auto ID_ALREADY_IN_HEAP = "The id is already in the heap!";
+		static constexpr auto KEY_INCREASED = "Can't decrease a key to a higher one!";
+
+		// Consts
+		static constexpr unsigned int NOT_IN_HEAP = ~0u;
+
+		// Subclasses
+		struct Entry
+		{
+			KeyType key;
+			unsigned int id;
+		};
+
+		// Data Members
+		std::vector<Entry> heap;
+		std::vector<unsigned int> positions;	// Where every id sits in 'heap', or NOT_IN_HEAP
+
+		// Methods
+		// The moving entry is held aside and only written once, at its final position
+		void SiftUp(size_t position)
+		{
+			const auto entry = heap[position];
+
+			while (position > 0)
+			{
+				const auto parent = (position - 1) / Arity;
+				if (!(entry.key < heap[parent].key)) break;
+
+				heap[position] = heap[parent];
+				positions[heap[position].id] = static_cast<unsigned int>(position);
+				position = parent;
+			}
+
+			heap[position] = entry;
+			positions[entry.id] = static_cast<unsigned int>(position);
+		}
+
+		void SiftDown(size_t position)
+		{
+			const auto entry = heap[position];
+
+			while (true)
+			{
+				const auto firstChild = position * Arity + 1;
+				if (firstChild >= heap.size()) break;
+
+				const auto lastChild = firstChild + Arity < heap.size() ? firstChild + Arity : heap.size();
+				auto smallest = firstChild;
+				for (auto child = firstChild + 1; child < lastChild; child++)
+				{
+					if (heap[child].key < heap[smallest].key) smallest = child;
+				}
+
+				if (!(heap[smallest].key < entry.key)) break;
+
+				heap[position] = heap[smallest];
+				positions[heap[position].id] = static_cast<unsigned int>(position);
+				position = smallest;
+			}
+
+			heap[position] = entry;
+			positions[entry.id] = static_cast<unsigned int>(position);
+		}
+	};
+}
+
+#endif // !INCLUDE_DATASTRUCTURES_DARYHEAP__H
@@ -0,0 +1,339 @@
+#ifndef INCLUDE_DATASTRUCTURES_DEQUE__H
+#define INCLUDE_DATASTRUCTURES_DEQUE__H
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+namespace containers
+{
+	// A double ended queue on a ring buffer. The capacity is always a power of two, so wrapping around is a single mask,
+	// and it doubles when the buffer is full. Adding and removing at both ends is O(1) and the elements stay contiguous
+	// (in at most two pieces), so a queue that was reserved up front never allocates.
+	template<typename ElementType, typename Allocator = std::allocator<ElementType>>
+	class Deque
+	{
+	public:
+		// Types
+		using allocator_type = Allocator;
+
+		// Subclasses
+		class Iterator
+		{
+			// Friend Classes
+			friend class Deque;
+
+		private:
+			// Error Messages
+			static constexpr auto DEREFERENCED_INVALID_ITERATOR = "Can't dereference a dangling iterator!";
+			static constexpr auto INCREMENTED_INVALID_ITERATOR = "Can't increment a dangling iterator!";
+			static constexpr auto DECREMENTED_INVALID_ITERATOR = "Can't decrement a dangling iterator!";
+
+			// Members
+			Deque* container;
+			size_t index;	// Counted from the front of the deque
+
+			// C'tors
+			Iterator(const Deque& container, size_t index) : container(const_cast<Deque*>(&container)), index(index) { }
+
+		public:
+			// C'tors
+			Iterator() : container(nullptr), index(0) { }
+
+			// Iterator Methods
+			inline auto& operator*() const
+			{
+				if (!container || index >= container->size) throw DEREFERENCED_INVALID_ITERATOR;
+				return (*container)[index];
+			}
+
+			inline auto& operator++()
+			{
+				if (!container || index >= container->size) throw INCREMENTED_INVALID_ITERATOR;
+				++index;
+				return *this;
+			}
+
+			auto operator++(int)
+			{
+				Iterator before = *this;
+				++(*this);
+
+				return before;
+			}
+
+			inline auto& operator--()
+			{
+				if (!container || index == 0) throw DECREMENTED_INVALID_ITERATOR;
+				--index;
+				return *this;
+			}
+
+			auto operator--(int)
+			{
+				Iterator before = *this;
+				--(*this);
+
+				return before;
+			}
+
+			inline auto operator-(const Iterator& other) const { return static_cast<std::ptrdiff_t>(index) - static_cast<std::ptrdiff_t>(other.index); }
+			inline auto operator!=(const Iterator& other) const { return container != other.container || index != other.index; }
+			inline auto operator==(const Iterator& other) const { return !(*this != other); }
+		};
+
+		// Constructors
+		Deque() : Deque(Allocator()) { }
+		explicit Deque(const Allocator& allocator) : allocator(allocator), elements(nullptr), capacity(0), front(0), size(0) { }
+		Deque(const Deque& other) : Deque(AllocatorTraits::select_on_container_copy_construction(other.allocator)) { Append(other); }
+		Deque(const Deque& other, const Allocator& allocator) : Deque(allocator) { Append(other); }
+		Deque(Deque&& other) noexcept : Deque(other.allocator) { Steal(other); }
+		Deque(Deque&& other, const Allocator& allocator) : Deque(allocator)
+		{
+			if (this->allocator == other.allocator) Steal(other);
+			else MoveElements(other);
+		}
+
+		// Only iterators can start a range, so this never stands in for the allocator constructors
+		template<typename BeginIteratorType, typename EndIteratorType, typename = decltype(*std::declval<BeginIteratorType&>())>
+		Deque(BeginIteratorType begin, EndIteratorType end, const Allocator& allocator = Allocator()) : Deque(allocator)
+		{
+			for (; begin != end; ++begin) Append(*begin);
+		}
+
+		// Destructor
+		~Deque() { Clear(); }
+
+		// Assignment Operator Methods
+		auto& operator=(const Deque& other)
+		{
+			if (&other == this) return *this;
+
+			MakeEmpty();
+			PropagateAllocator(other, typename AllocatorTraits::propagate_on_container_copy_assignment());
+
+			return Append(other);
+		}
+
+		auto& operator=(Deque&& other) noexcept(AllocatorTraits::propagate_on_container_move_assignment::value)
+		{
+			if (&other == this) return *this;
+
+			Clear();
+			PropagateAllocator(other, typename AllocatorTraits::propagate_on_container_move_assignment());
+
+			if (allocator == other.allocator) Steal(other);
+			else MoveElements(other);
+
+			return *this;
+		}
+
+		// Getters
+		inline auto Size() const { return size; }
+		inline auto IsEmpty() const { return size == 0; }
+		inline auto Capacity() const { return capacity; }
+		inline auto GetAllocator() const { return allocator; }
+		inline auto begin() const { return Iterator(*this, 0); }
+		inline auto end() const { return Iterator(*this, size); }
+		inline auto Contains(const ElementType& element) const
+		{
+			for (const auto& current : *this) if (current == element) return true;
+			return false;
+		}
+
+		inline auto& operator[](size_t index) { return elements[(front + index) & (capacity - 1)]; }
+		inline const auto& operator[](size_t index) const { return elements[(front + index) & (capacity - 1)]; }
+
+		inline auto& First()
+		{
+			if (IsEmpty()) throw GET_ELEMENT_WHEN_EMPTY;
+			return elements[front];
+		}
+
+		inline const auto& First() const
+		{
+			if (IsEmpty()) throw GET_ELEMENT_WHEN_EMPTY;
+			return elements[front];
+		}
+
+		inline auto& Last()
+		{
+			if (IsEmpty()) throw GET_ELEMENT_WHEN_EMPTY;
+			return (*this)[size - 1];
+		}
+
+		inline const auto& Last() const
+		{
+			if (IsEmpty()) throw GET_ELEMENT_WHEN_EMPTY;
+			return (*this)[size - 1];
+		}
+
+		// Deque Manipulation
+		auto& Append(ElementType element)
+		{
+			if (size == capacity) Grow(size + 1);
+
+			AllocatorTraits::construct(allocator, &elements[(front + size) & (capacity - 1)], std::move(element));
+			++size;
+
+			return *this;
+		}
+
+		auto& Append(const Deque& other)
+		{
+			// The size is taken first, so appending a deque to itself stops at its original end
+			const auto otherSize = other.size;
+			Reserve(size + otherSize);
+
+			for (size_t index = 0; index < otherSize; index++) Append(other[index]);
+
+			return *this;
+		}
+
+		auto& Prepend(ElementType element)
+		{
+			if (size == capacity) Grow(size + 1);
+
+			const auto newFront = (front + capacity - 1) & (capacity - 1);
+			AllocatorTraits::construct(allocator, &elements[newFront], std::move(element));
+			front = newFront;
+			++size;
+
+			return *this;
+		}
+
+		auto& RemoveFirst()
+		{
+			if (IsEmpty()) throw REMOVED_ELEMENT_WHEN_EMPTY;
+
+			AllocatorTraits::destroy(allocator, &elements[front]);
+			front = (front + 1) & (capacity - 1);
+			--size;
+
+			return *this;
+		}
+
+		auto& RemoveLast()
+		{
+			if (IsEmpty()) throw REMOVED_ELEMENT_WHEN_EMPTY;
+
+			AllocatorTraits::destroy(allocator, &(*this)[size - 1]);
+			--size;
+
+			return *this;
+		}
+
+		// Makes sure that the deque can hold 'count' elements in total without allocating
+		auto& Reserve(size_t count)
+		{
+			if (count > capacity) Grow(count);
+			return *this;
+		}
+
+		template<typename Container>
+		inline auto& operator+=(const Container& other) { return Append(other); }
+
+		// Removes the elements but keeps the buffer
+		auto& MakeEmpty()
+		{
+			while (size > 0) RemoveLast();
+			front = 0;
+
+			return *this;
+		}
+
+		// Removes the elements and frees the buffer
+		auto& Clear()
+		{
+			MakeEmpty();
+
+			if (elements) AllocatorTraits::deallocate(allocator, elements, capacity);
+			elements = nullptr;
+			capacity = 0;
+
+			return *this;
+		}
+
+	private:
+		// Error Messages
+		static constexpr auto NEW_FAILED = "Failed to allocate memory with 'new'!";
+		static constexpr auto GET_ELEMENT_WHEN_EMPTY = "Can't get an element when the deque is empty!";
+		static constexpr auto REMOVED_ELEMENT_WHEN_EMPTY = "Can't remove an element when the deque is empty!";
+
+		// Consts
+		static constexpr size_t MIN_CAPACITY = 8;
+
+		// Types
+		using AllocatorTraits = std::allocator_traits<Allocator>;
+
+		// Data Members
+		Allocator allocator;
+		ElementType* elements;
+		size_t capacity;	// Always zero or a power of two
+		size_t front;
+		size_t size;
+
+		// Methods
+		// Moves the elements to the front of a new buffer with room for at least 'count' of them
+		void Grow(size_t count)
+		{
+			size_t newCapacity = capacity == 0 ? MIN_CAPACITY : capacity * 2;
+			while (newCapacity < count) newCapacity *= 2;
+
+			ElementType* newElements = AllocatorTraits::allocate(allocator, newCapacity);
+			if (!newElements) throw NEW_FAILED;
+
+			for (size_t index = 0; index < size; index++)
+			{
+				auto& element = (*this)[index];
+				AllocatorTraits::construct(allocator, &newElements[index], std::move(element));
+				AllocatorTraits::destroy(allocator, &element);
+			}
+
+			if (elements) AllocatorTraits::deallocate(allocator, elements, capacity);
+			elements = newElements;
+			capacity = newCapacity;
+			front = 0;
+		}
+
+		void Steal(Deque& other)
+		{
+			elements = other.elements;
+			capacity = other.capacity;
+			front = other.front;
+			size = other.size;
+
+			other.elements = nullptr;
+			other.capacity = other.front = other.size = 0;
+		}
+
+		// The buffer of 'other' belongs to a different allocator, so only its elements are moved
+		void MoveElements(Deque& other)
+		{
+			Reserve(other.size);
+			for (size_t index = 0; index < other.size; index++) Append(std::move(other[index]));
+			other.Clear();
+		}
+
+		// Our buffer can only be freed by the allocator that made it, so it's freed before the allocator is replaced
+		void PropagateAllocator(const Deque& other, std::true_type)
+		{
+			if (allocator == other.allocator) return;
+
+			Clear();
+			allocator = other.allocator;
+		}
+
+		void PropagateAllocator(const Deque&, std::false_type) { }
+	};
+
+	namespace pmr
+	{
+		template<typename ElementType>
+		using Deque = containers::Deque<ElementType, std::pmr::polymorphic_allocator<ElementType>>;
+	}
+}
+
+#endif // !INCLUDE_DATASTRUCTURES_DEQUE__H
@@ -1,17 +1,33 @@
 #ifndef INCLUDE_DATASTRUCTURES_LINKEDLIST_LINKEDLISTARRAY__H
 #define INCLUDE_DATASTRUCTURES_LINKEDLIST_LINKEDLISTARRAY__H
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
 #include <vector>
+#include "DataStructures/SimdSearch.h"
 
 namespace containers
 {
-	template<typename ElementType>
+	// The elements and the links between them are kept in vectors that take their memory from 'Allocator',
+	// so copying and moving the list propagates the allocator the same way the vectors do.
+	// A bitmap of the slots in use lets the searches that don't care about order scan 'elements' as a plain array.
+	template<typename ElementType, typename Allocator = std::allocator<ElementType>>
 	class LinkedListArray
 	{
 		// Friend Classes
 		friend class LinkedNode;
 
 	public:
+		// Types
+		using allocator_type = Allocator;
+		using reference = typename std::vector<ElementType, Allocator>::reference;	// A proxy to a packed bit in a list of bool
+		using const_reference = typename std::vector<ElementType, Allocator>::const_reference;
+
 		// Subclasses
 		class LinkedNode
 		{
@@ -42,13 +58,13 @@ namespace containers
 			LinkedNode& operator=(LinkedNode&&) = default;
 
 			// Iterator Methods
-			inline auto& operator*() 
+			inline reference operator*() 
 			{
 				if (dataIndex == NONEXISTENT_ELEMENT) throw DEREFERENCED_INVALID_ITERATOR;
 				return container->elements[dataIndex]; 
 			}
 
-			inline const auto& operator*() const 
+			inline const_reference operator*() const 
 			{
 				if (dataIndex == NONEXISTENT_ELEMENT) throw DEREFERENCED_INVALID_ITERATOR;
 				return container->elements[dataIndex]; 
@@ -90,59 +106,139 @@ namespace containers
 			inline auto operator==(const LinkedNode& other) const { return !(*this != other); }
 		};
 
+		// Stands for one element of a list until it's removed. The elements never move, so the index of the slot is enough to
+		// find it, and the slot's generation (which changes whenever the slot is freed) tells a stale handle from a good one.
+		class Handle
+		{
+			// Friend Classes
+			friend class LinkedListArray;
+
+		public:
+			// C'tors
+			Handle() : index(NONEXISTENT_ELEMENT), generation(0) { }
+
+			// Methods
+			inline auto operator==(const Handle& other) const { return index == other.index && generation == other.generation; }
+			inline auto operator!=(const Handle& other) const { return !(*this == other); }
+
+		private:
+			// Members
+			int index;
+			unsigned int generation;
+
+			// C'tors
+			Handle(int index, unsigned int generation) : index(index), generation(generation) { }
+		};
+
 		// Constructors
-		LinkedListArray(size_t capacity = 256) : elements(capacity), elementNexts(capacity), elementPrevs(capacity) { Clear(); }
-		LinkedListArray(const LinkedListArray& other) : LinkedListArray(other.Capacity()) { *this = other; }
+		LinkedListArray(size_t capacity = DEFAULT_CAPACITY, const Allocator& allocator = Allocator())
+			: elements(capacity, allocator),
+			  elementNexts(capacity, IndexAllocator(allocator)),
+			  elementPrevs(capacity, IndexAllocator(allocator)),
+			  generations(capacity, 0, GenerationAllocator(allocator)),
+			  occupied((capacity + simd::BLOCK_SIZE - 1) / simd::BLOCK_SIZE, 0, BitmapAllocator(allocator)) { Clear(); }
+		explicit LinkedListArray(const Allocator& allocator) : LinkedListArray(DEFAULT_CAPACITY, allocator) { }
+		LinkedListArray(const LinkedListArray& other) = default;
 		LinkedListArray(LinkedListArray&& other) = default;
 
+		LinkedListArray(const LinkedListArray& other, const Allocator& allocator) : LinkedListArray(other.Capacity(), allocator) { Append(other); }
+		LinkedListArray(LinkedListArray&& other, const Allocator& allocator) : LinkedListArray(other.Capacity(), allocator)
+		{
+			for (auto& element : other) Append(std::move(element));
+		}
+
 		template<typename BeginIteratorType, typename EndIteratorType>
-		LinkedListArray(unsigned int capacity, const BeginIteratorType& begin, const EndIteratorType& end) : LinkedListArray(capacity) { Append(begin, end); }
+		LinkedListArray(unsigned int capacity, BeginIteratorType begin, EndIteratorType end, const Allocator& allocator = Allocator()) : LinkedListArray(capacity, allocator)
+		{
+			AppendRange(begin, end);
+		}
 
 		// Destructor
 		~LinkedListArray() = default;
 
 		// Assignment Operator Methods
+		// A copy takes the capacity of 'other' along with its elements, just like the copy constructor
 		LinkedListArray& operator=(LinkedListArray&& other) = default;
-		inline auto& operator=(const LinkedListArray& other)
-		{
-			return &other != this ? Clear().Append(other) : *this;
-		}
+		LinkedListArray& operator=(const LinkedListArray& other) = default;
 
 		// Getters
 		inline auto Size() const { return size; }
 		inline auto IsEmpty() const { return size == 0; }
 		inline auto Capacity() const { return elements.size(); }
+		inline auto GetAllocator() const { return elements.get_allocator(); }
 		inline auto begin() const { return LinkedNode(*this, firstIndex); }
 		inline auto end() const { return LinkedNode(*this, NONEXISTENT_ELEMENT); }
+
+		// The searches go over the slots in the order they sit in memory, 64 at a time, and mask out the free ones
 		inline auto Contains(const ElementType& element) const
 		{
-			for (const auto& current : *this) if (current == element) return true;
-			return false;
+			return !ScanMatches(element, [](unsigned int, std::uint64_t) { return false; });
 		}
-		inline auto& First() 
+
+		auto Count(const ElementType& element) const
+		{
+			unsigned int count = 0;
+			ScanMatches(element, [&](unsigned int, std::uint64_t matches) { count += simd::CountBits(matches); return true; });
+
+			return count;
+		}
+
+		// A handle to one of the elements that equal 'element' (not necessarily the first), or an invalid handle
+		auto FindAny(const ElementType& element) const
+		{
+			Handle found;
+			ScanMatches(element, [&](unsigned int base, std::uint64_t matches)
+			{
+				const auto index = static_cast<int>(base + simd::GetLowestBit(matches));
+				found = Handle(index, generations[index]);
+				return false;
+			});
+
+			return found;
+		}
+
+		inline reference First() 
 		{
 			if (IsEmpty()) throw GET_ELEMENT_WHEN_EMPTY;
 			return elements[firstIndex]; 
 		}
 
-		inline const auto& First() const 
+		inline const_reference First() const 
 		{
 			if (IsEmpty()) throw GET_ELEMENT_WHEN_EMPTY;
 			return elements[firstIndex]; 
 		}
 
-		inline auto& Last() 
+		inline reference Last() 
 		{
 			if (IsEmpty()) throw GET_ELEMENT_WHEN_EMPTY;
 			return elements[lastIndex]; 
 		}
 
-		inline const auto& Last() const 
+		inline const_reference Last() const 
 		{
 			if (IsEmpty()) throw GET_ELEMENT_WHEN_EMPTY;
 			return elements[lastIndex];
 		}
 
+		// Whether 'handle' still stands for an element of this list
+		inline auto IsValid(const Handle& handle) const
+		{
+			return handle.index >= 0 && static_cast<size_t>(handle.index) < Capacity() && generations[handle.index] == handle.generation;
+		}
+
+		inline reference operator[](const Handle& handle)
+		{
+			if (!IsValid(handle)) throw USED_STALE_HANDLE;
+			return elements[handle.index];
+		}
+
+		inline const_reference operator[](const Handle& handle) const
+		{
+			if (!IsValid(handle)) throw USED_STALE_HANDLE;
+			return elements[handle.index];
+		}
+
 		// List Manipulation
 		auto& Append(ElementType element)
 		{
@@ -151,6 +247,7 @@ namespace containers
 			if (size == 0)
 			{
 				firstIndex = lastIndex = freeIndex;
+				elementPrevs[firstIndex] = NONEXISTENT_ELEMENT;
 			}
 			else
 			{
@@ -162,6 +259,7 @@ namespace containers
 			elements[lastIndex] = std::move(element);
 			freeIndex = elementNexts[freeIndex];
 			elementNexts[lastIndex] = NONEXISTENT_ELEMENT;
+			MarkOccupied(lastIndex);
 			++size;
 
 			return *this;
@@ -169,82 +267,133 @@ namespace containers
 
 		auto& Append(const LinkedListArray& other)
 		{
-			unsigned int count = 0;
+			// The size is taken first, so appending a list to itself stops at its original end
 			unsigned int otherSize = other.size;
+			if (otherSize > Capacity() - size) throw ADD_ELEMENT_WHEN_FULL;
 
-			for (const auto& otherData : other)
+			for (auto current = other.firstIndex; otherSize > 0; current = other.elementNexts[current], otherSize--)
 			{
-				Append(otherData);
-
-				if (++count == otherSize)
-				{
-					break;
-				}
+				Append(other.elements[current]);
 			}
 
 			return *this;
 		}
 
 		template<typename BeginIteratorType, typename EndIteratorType>
-		auto& Append(const BeginIteratorType& begin, const EndIteratorType& end)
+		auto& Append(BeginIteratorType begin, EndIteratorType end)
+		{
+			return AppendRange(begin, end);
+		}
+
+		// Appends everything from 'begin' to 'end'. When the iterators can tell the distance between them,
+		// the capacity is checked once up front, so a range that doesn't fit leaves the list untouched.
+		template<typename BeginIteratorType, typename EndIteratorType>
+		auto& AppendRange(BeginIteratorType begin, EndIteratorType end)
 		{
+			if (GetDistance(begin, end, 0) > Capacity() - size) throw ADD_ELEMENT_WHEN_FULL;
+
 			while (begin != end)
 			{
-				Append(*(begin++));
+				Append(*begin);
+				++begin;
 			}
+
+			return *this;
 		}
 
 		template<typename Any>
 		inline auto& Prepend(Any&& other)
 		{
-			return *this = LinkedListArray<ElementType>(Capacity()).Append(std::forward<Any>(other)).Append(*this);
+			return *this = LinkedListArray(Capacity(), GetAllocator()).Append(std::forward<Any>(other)).Append(*this);
 		}
 
 		template<typename BeginIteratorType, typename EndIteratorType>
 		auto& Prepend(const BeginIteratorType& begin, const EndIteratorType& end)
 		{
-			return *this = LinkedListArray<ElementType>(Capacity()).Append(begin, end).Append(*this);
+			return *this = LinkedListArray(Capacity(), GetAllocator()).Append(begin, end).Append(*this);
 		}
 
 		template<typename Container>
 		inline auto& operator+=(const Container& other) { return Append(other); }
 
 		template<typename Container>
-		inline auto operator+(const Container& other) { return LinkedListArray(*this).Append(other); }
+		inline auto operator+(const Container& other)
+		{
+			LinkedListArray result(*this);
+			result.Append(other);
+
+			return result;
+		}
 
 		auto& Remove(const ElementType& element)
 		{
-			auto currentIndex = firstIndex;
+			// The element is copied, since it might be one of the elements that get removed
+			return RemoveIf([element](const ElementType& current) { return current == element; });
+		}
 
-			while (currentIndex != NONEXISTENT_ELEMENT)
+		// Removes every element that 'predicate' accepts in a single pass, relinking the remaining indices as we go
+		template<typename Predicate>
+		auto& RemoveIf(Predicate predicate)
+		{
+			int kept = NONEXISTENT_ELEMENT;
+			int current = firstIndex;
+			firstIndex = NONEXISTENT_ELEMENT;
+
+			while (current != NONEXISTENT_ELEMENT)
 			{
-				if (elements[currentIndex] == element)
+				auto next = elementNexts[current];
+
+				if (predicate(elements[current]))
 				{
-					if (currentIndex == lastIndex)
-					{
-						lastIndex = elementPrevs[lastIndex];
-						elementNexts[lastIndex] = NONEXISTENT_ELEMENT;
-					}
+					DeleteIndex(current);
+				}
+				else
+				{
+					elementPrevs[current] = kept;
+					if (kept == NONEXISTENT_ELEMENT) firstIndex = current;
+					else elementNexts[kept] = current;
+					kept = current;
+				}
 
-					if (currentIndex == firstIndex)
-					{
-						firstIndex = elementNexts[firstIndex];
-						elementPrevs[firstIndex] = NONEXISTENT_ELEMENT;
-					}
+				current = next;
+			}
+
+			lastIndex = kept;
+			if (kept != NONEXISTENT_ELEMENT) elementNexts[kept] = NONEXISTENT_ELEMENT;
+
+			return *this;
+		}
+
+		// Removes every element that equals the one before it, in a single pass (on a sorted list this removes all duplicates)
+		template<typename EqualityComparator = std::equal_to<ElementType>>
+		auto& Unique(EqualityComparator isEqual = EqualityComparator())
+		{
+			if (size < 2) return *this;
+
+			int kept = firstIndex;
+			int current = elementNexts[firstIndex];
 
-					elementNexts[elementPrevs[currentIndex]] = elementNexts[currentIndex];
-					elementPrevs[elementNexts[currentIndex]] = elementPrevs[currentIndex];
+			while (current != NONEXISTENT_ELEMENT)
+			{
+				auto next = elementNexts[current];
 
-					auto toDelete = currentIndex;
-					currentIndex = elementNexts[currentIndex];
-					DeleteIndex(toDelete);
+				if (isEqual(elements[kept], elements[current]))
+				{
+					DeleteIndex(current);
 				}
 				else
 				{
-					currentIndex = elementNexts[currentIndex];
+					elementNexts[kept] = current;
+					elementPrevs[current] = kept;
+					kept = current;
 				}
+
+				current = next;
 			}
 
+			lastIndex = kept;
+			elementNexts[kept] = NONEXISTENT_ELEMENT;
+
 			return *this;
 		}
 
@@ -288,6 +437,140 @@ namespace containers
 			return *this;
 		}
 
+		// Appends the element and returns a handle to it, which 'Erase' can remove in O(1)
+		auto Insert(ElementType element)
+		{
+			Append(std::move(element));
+			return Handle(lastIndex, generations[lastIndex]);
+		}
+
+		// Inserts the element right before the one that 'before' stands for
+		auto Insert(const Handle& before, ElementType element)
+		{
+			if (!IsValid(before)) throw USED_STALE_HANDLE;
+			if (size == Capacity()) throw ADD_ELEMENT_WHEN_FULL;
+
+			const int newIndex = freeIndex;
+			const int previous = elementPrevs[before.index];
+			freeIndex = elementNexts[newIndex];
+
+			elements[newIndex] = std::move(element);
+			elementNexts[newIndex] = before.index;
+			elementPrevs[newIndex] = previous;
+			elementPrevs[before.index] = newIndex;
+
+			if (previous == NONEXISTENT_ELEMENT) firstIndex = newIndex;
+			else elementNexts[previous] = newIndex;
+
+			MarkOccupied(newIndex);
+			++size;
+
+			return Handle(newIndex, generations[newIndex]);
+		}
+
+		// Removes just the element that 'handle' stands for, without looking at any other element
+		auto& Erase(const Handle& handle)
+		{
+			if (!IsValid(handle)) throw USED_STALE_HANDLE;
+
+			const int previous = elementPrevs[handle.index];
+			const int next = elementNexts[handle.index];
+
+			if (previous != NONEXISTENT_ELEMENT) elementNexts[previous] = next;
+			else firstIndex = next;
+
+			if (next != NONEXISTENT_ELEMENT) elementPrevs[next] = previous;
+			else lastIndex = previous;
+
+			DeleteIndex(handle.index);
+
+			return *this;
+		}
+
+		// Stable bottom-up merge sort that only relinks indices, the elements never move.
+		// Without a comparator, lists of unsigned integers are radix sorted instead.
+		auto& Sort() { return Sort(std::less<ElementType>(), IsRadixSortable()); }
+
+		template<typename Comparator>
+		auto& Sort(Comparator comparator)
+		{
+			if (size < 2) return *this;
+
+			// The chain of nexts already ends with NONEXISTENT_ELEMENT, the previous indices are fixed at the end
+			int head = firstIndex;
+
+			for (unsigned int width = 1; width < size; width *= 2)
+			{
+				int remaining = head;
+				int* tail = &head;
+
+				while (remaining != NONEXISTENT_ELEMENT)
+				{
+					int left = remaining;
+					int right = SplitChain(left, width);
+					remaining = SplitChain(right, width);
+
+					while (left != NONEXISTENT_ELEMENT && right != NONEXISTENT_ELEMENT)
+					{
+						// Taking from the left on ties keeps the sort stable
+						auto& taken = comparator(elements[right], elements[left]) ? right : left;
+						*tail = taken;
+						tail = &elementNexts[taken];
+						taken = elementNexts[taken];
+					}
+
+					*tail = left != NONEXISTENT_ELEMENT ? left : right;
+					while (*tail != NONEXISTENT_ELEMENT) tail = &elementNexts[*tail];
+				}
+			}
+
+			return RelinkChain(head);
+		}
+
+		// Stable LSD radix sort for unsigned integers, one byte at a time. Every pass deals the indices into 256 buckets
+		// and chains the buckets back together, so it's O(n) per byte and only relinks indices. Bytes above the largest
+		// element are skipped, so small numbers (like town numbers) take just a couple of passes.
+		auto& RadixSort()
+		{
+			static_assert(IsRadixSortable::value, "Radix sort only works on unsigned integers!");
+			if (size < 2) return *this;
+
+			ElementType largest = 0;
+			for (const auto& element : *this) if (element > largest) largest = element;
+
+			int head = firstIndex;
+
+			for (unsigned int shift = 0; shift < sizeof(ElementType) * 8 && (largest >> shift) != 0; shift += 8)
+			{
+				int bucketHeads[RADIX];
+				int* bucketTails[RADIX];
+				for (unsigned int bucket = 0; bucket < RADIX; bucket++)
+				{
+					bucketHeads[bucket] = NONEXISTENT_ELEMENT;
+					bucketTails[bucket] = &bucketHeads[bucket];
+				}
+
+				for (auto current = head; current != NONEXISTENT_ELEMENT; current = elementNexts[current])
+				{
+					const auto bucket = static_cast<unsigned int>((elements[current] >> shift) & (RADIX - 1));
+					*bucketTails[bucket] = current;
+					bucketTails[bucket] = &elementNexts[current];
+				}
+
+				int* tail = &head;
+				for (unsigned int bucket = 0; bucket < RADIX; bucket++)
+				{
+					if (bucketHeads[bucket] == NONEXISTENT_ELEMENT) continue;
+					*tail = bucketHeads[bucket];
+					tail = bucketTails[bucket];
+				}
+
+				*tail = NONEXISTENT_ELEMENT;
+			}
+
+			return RelinkChain(head);
+		}
+
 		auto& MakeEmpty() { return Clear(); }
 		auto& Clear()
 		{
@@ -295,12 +578,16 @@ namespace containers
 			size = 0;
 			firstIndex = lastIndex = NONEXISTENT_ELEMENT;
 
+			// Every slot gets a new generation, so the handles to the old elements go stale
 			for (unsigned int index = 0; index < Capacity(); index++)
 			{
 				elementNexts[index] = index + 1;
 				elementPrevs[index] = NONEXISTENT_ELEMENT;
+				++generations[index];
 			}
 
+			std::fill(occupied.begin(), occupied.end(), 0);
+
 			return *this;
 		}
 
@@ -309,14 +596,24 @@ namespace containers
 		static constexpr auto GET_ELEMENT_WHEN_EMPTY = "Can't get an element when the list is empty!";
 		static constexpr auto REMOVED_ELEMENT_WHEN_EMPTY = "Can't remove an element when the list is empty!";
 		static constexpr auto ADD_ELEMENT_WHEN_FULL = "Not enough capacity to add an element to the list!";
+		static constexpr auto USED_STALE_HANDLE = "Can't use a handle to an element that was removed!";
 
 		// Consts
 		static constexpr auto NONEXISTENT_ELEMENT = -1;
+		static constexpr unsigned int RADIX = 256;
+		static constexpr size_t DEFAULT_CAPACITY = 256;
+
+		// Types
+		using IndexAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<int>;
+		using GenerationAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<unsigned int>;
+		using BitmapAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<std::uint64_t>;
 
 		// Data Members
-		std::vector<ElementType> elements;
-		std::vector<int> elementNexts;
-		std::vector<int> elementPrevs;
+		std::vector<ElementType, Allocator> elements;
+		std::vector<int, IndexAllocator> elementNexts;
+		std::vector<int, IndexAllocator> elementPrevs;
+		std::vector<unsigned int, GenerationAllocator> generations;	// Changes whenever the slot is freed
+		std::vector<std::uint64_t, BitmapAllocator> occupied;			// Bit i of word w is set when slot 64w+i holds an element
 		unsigned int size;
 		int firstIndex;
 		int lastIndex;
@@ -327,10 +624,113 @@ namespace containers
 		{
 			elementNexts[deletedIndex] = freeIndex;
 			freeIndex = deletedIndex;
+			++generations[deletedIndex];
+			occupied[deletedIndex / simd::BLOCK_SIZE] &= ~(std::uint64_t(1) << (deletedIndex % simd::BLOCK_SIZE));
 			elements[deletedIndex] = ElementType();
 			--size;
 		}
+
+		inline void MarkOccupied(int index)
+		{
+			occupied[index / simd::BLOCK_SIZE] |= std::uint64_t(1) << (index % simd::BLOCK_SIZE);
+		}
+
+		// Calls 'onMatches(base, matches)' for every 64 slots from 'base' that hold a match, with a bit for each of them,
+		// until it returns false. Returns whether the scan went all the way.
+		template<typename OnMatches>
+		bool ScanMatches(const ElementType& element, OnMatches onMatches) const
+		{
+			for (unsigned int block = 0; block < occupied.size(); block++)
+			{
+				if (occupied[block] == 0) continue;
+
+				const auto matches = MatchOccupied(block, element, simd::IsVectorizable<ElementType>());
+				if (matches != 0 && !onMatches(block * simd::BLOCK_SIZE, matches)) return false;
+			}
+
+			return true;
+		}
+
+		// The slots of 'block' that are in use and equal 'element'. Integers (other than bool) are compared a vector at a time.
+		std::uint64_t MatchOccupied(unsigned int block, const ElementType& element, std::true_type) const
+		{
+			const auto capacity = static_cast<unsigned int>(Capacity());
+			const auto base = block * simd::BLOCK_SIZE;
+
+			return occupied[block] & (capacity - base >= simd::BLOCK_SIZE ?
+				simd::MatchBlock(elements.data() + base, element) :
+				simd::MatchScalar(elements.data() + base, capacity - base, element));
+		}
+
+		// Everything else (including the packed bits of a vector<bool>) is compared one slot in use at a time
+		std::uint64_t MatchOccupied(unsigned int block, const ElementType& element, std::false_type) const
+		{
+			const auto base = block * simd::BLOCK_SIZE;
+			std::uint64_t matches = 0;
+
+			for (auto slots = occupied[block]; slots != 0; slots &= slots - 1)
+			{
+				const auto slot = simd::GetLowestBit(slots);
+				if (elements[base + slot] == element) matches |= std::uint64_t(1) << slot;
+			}
+
+			return matches;
+		}
+
+		template<typename IteratorType>
+		static auto GetDistance(const IteratorType& begin, const IteratorType& end, int) -> decltype(static_cast<size_t>(end - begin))
+		{
+			return static_cast<size_t>(end - begin);
+		}
+
+		// Iterators that can't tell their distance are checked one element at a time
+		template<typename BeginIteratorType, typename EndIteratorType>
+		static size_t GetDistance(const BeginIteratorType&, const EndIteratorType&, long) { return 0; }
+
+		// bool is unsigned too, but it has nothing to radix sort
+		using IsRadixSortable = std::integral_constant<bool, std::is_unsigned<ElementType>::value && !std::is_same<ElementType, bool>::value>;
+
+		template<typename Comparator>
+		inline auto& Sort(Comparator comparator, std::false_type) { return Sort(comparator); }
+
+		template<typename Comparator>
+		inline auto& Sort(Comparator, std::true_type) { return RadixSort(); }
+
+		// Cuts the chain after 'count' indices, and returns the rest of it
+		int SplitChain(int chain, unsigned int count)
+		{
+			for (unsigned int index = 1; chain != NONEXISTENT_ELEMENT && index < count; index++) chain = elementNexts[chain];
+			if (chain == NONEXISTENT_ELEMENT) return NONEXISTENT_ELEMENT;
+
+			auto rest = elementNexts[chain];
+			elementNexts[chain] = NONEXISTENT_ELEMENT;
+
+			return rest;
+		}
+
+		// Makes the list out of a chain of its own indices that ends with NONEXISTENT_ELEMENT
+		auto& RelinkChain(int head)
+		{
+			int previous = NONEXISTENT_ELEMENT;
+			firstIndex = head;
+
+			for (auto current = head; current != NONEXISTENT_ELEMENT; current = elementNexts[current])
+			{
+				elementPrevs[current] = previous;
+				previous = current;
+			}
+
+			lastIndex = previous;
+
+			return *this;
+		}
 	};
+
+	namespace pmr
+	{
+		template<typename ElementType>
+		using LinkedListArray = containers::LinkedListArray<ElementType, std::pmr::polymorphic_allocator<ElementType>>;
+	}
 }
 
 #endif // !INCLUDE_DATASTRUCTURES_LINKEDLIST_LINKEDLISTARRAY__H
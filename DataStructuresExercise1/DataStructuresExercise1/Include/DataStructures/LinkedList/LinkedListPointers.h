@@ -1,14 +1,32 @@
 #ifndef INCLUDE_DATASTRUCTURES_LINKEDLIST_LINKEDLISTPOINTERS__H
 #define INCLUDE_DATASTRUCTURES_LINKEDLIST_LINKEDLISTPOINTERS__H
 
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
 #include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
 
 namespace containers
 {
-	template<typename ElementType>
+	// The nodes of the list are allocated in blocks that grow with the list, and removed nodes are kept for reuse
+	// instead of being deleted. Building a list costs a handful of allocations instead of one per element, and
+	// all of its memory is released together by 'Clear' (or when the list is destroyed). The nodes of removed elements
+	// stay with the list until then, unless 'ShrinkToFit' gives them back.
+	// The blocks come from 'Allocator', which follows the standard rules for propagating on copy, move and swap.
+	template<typename ElementType, typename Allocator = std::allocator<ElementType>>
 	class LinkedListPointers
 	{
 	public:
+		// Types
+		using allocator_type = Allocator;
+
 		// Subclasses
 		class LinkedNode
 		{
@@ -88,13 +106,105 @@ namespace containers
 			inline auto operator==(const LinkedNode& other) const { return !(*this != other); }
 		};
 
-		// Constructors
-		LinkedListPointers() : first(&dummy), last(&dummy), size(0) { }
-		LinkedListPointers(const LinkedListPointers& other) : LinkedListPointers() { *this = other; }
-		LinkedListPointers(LinkedListPointers&& other) : LinkedListPointers() { *this = std::move(other); }
+		// Stands for one node of a list until that node is removed. Nodes never move while they're in the list, so the
+		// handle stays good through any other change, except for 'Linearize', 'Clear' and assigning the list over.
+		class Handle
+		{
+			// Friend Classes
+			friend class LinkedListPointers;
 
-		template<typename BeginIteratorType, typename EndIteratorType>
-		LinkedListPointers(const BeginIteratorType& begin, const EndIteratorType& end) : LinkedListPointers() { Append(begin, end); }
+		public:
+			// C'tors
+			Handle() : node(nullptr) { }
+
+			// Methods
+			inline auto operator==(const Handle& other) const { return node == other.node; }
+			inline auto operator!=(const Handle& other) const { return node != other.node; }
+
+		private:
+			// Members
+			LinkedNode* node;
+
+			// C'tors
+			explicit Handle(LinkedNode* node) : node(node) { }
+		};
+
+		// Walks a list while prefetching the node PREFETCH_DISTANCE places ahead, so on a list that's scattered in memory
+		// the cache misses overlap instead of waiting for each other. A linked list can't tell where that node is without
+		// walking to it, so every walk records the addresses it passes and the next walk prefetches from them.
+		// The walks always follow the list itself, so changing the list never makes them wrong: the addresses are only
+		// hints (prefetching a node that's gone does nothing), and the first walk after a change records them again.
+		// The list must outlive the walker.
+		class SkipPointers
+		{
+		public:
+			// Constructors
+			explicit SkipPointers(const LinkedListPointers& list) : list(&list), nodes(NodePointerAllocator(list.GetAllocator())) { }
+
+			// Getters
+			inline auto Size() const { return list->Size(); }
+			auto Contains(const ElementType& element)
+			{
+				bool isFound = false;
+				Walk([&](const ElementType& current) { return !(isFound = current == element); });
+
+				return isFound;
+			}
+
+			// Methods
+			// Calls 'function' with every element, in the order of the list
+			template<typename Function>
+			void ForEach(Function function)
+			{
+				Walk([&](const ElementType& current)
+				{
+					function(current);
+					return true;
+				});
+			}
+
+		private:
+			// Types
+			using NodePointerAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<const LinkedNode*>;
+
+			// Data Members
+			const LinkedListPointers* list;
+			std::vector<const LinkedNode*, NodePointerAllocator> nodes;	// The nodes the last walks passed, in order
+
+			// Methods
+			// Goes on while 'function' returns true
+			template<typename Function>
+			void Walk(Function function)
+			{
+				size_t index = 0;
+				for (auto current = list->first; current != &dummy; current = current->next, index++)
+				{
+					if (index + PREFETCH_DISTANCE < nodes.size()) Prefetch(nodes[index + PREFETCH_DISTANCE]);
+
+					if (index < nodes.size()) nodes[index] = current;
+					else nodes.push_back(current);
+
+					if (!function(current->data)) return;
+				}
+
+				nodes.resize(index);
+			}
+		};
+
+		// Constructors
+		LinkedListPointers() : LinkedListPointers(Allocator()) { }
+		explicit LinkedListPointers(const Allocator& allocator) : first(&dummy), last(&dummy), size(0), blocks(allocator) { }
+		LinkedListPointers(const LinkedListPointers& other) : LinkedListPointers(AllocatorTraits::select_on_container_copy_construction(other.GetAllocator())) { Append(other); }
+		LinkedListPointers(const LinkedListPointers& other, const Allocator& allocator) : LinkedListPointers(allocator) { Append(other); }
+		LinkedListPointers(LinkedListPointers&& other) noexcept : LinkedListPointers(other.GetAllocator()) { Append(std::move(other)); }
+		LinkedListPointers(LinkedListPointers&& other, const Allocator& allocator) : LinkedListPointers(allocator) { Append(std::move(other)); }
+
+		// Only iterators can start a range, so this never stands in for the allocator constructors
+		template<typename BeginIteratorType, typename EndIteratorType, typename = decltype(*std::declval<BeginIteratorType&>())>
+		LinkedListPointers(BeginIteratorType begin, EndIteratorType end, size_t sizeHint = 0, const Allocator& allocator = Allocator()) : LinkedListPointers(allocator)
+		{
+			AppendRange(begin, end, sizeHint);
+		}
 
 		// Destructor
 		~LinkedListPointers() { Clear(); }
@@ -102,17 +212,29 @@ namespace containers
 		// Assignment Operator Methods
 		inline auto& operator=(LinkedListPointers&& other)
 		{
-			return this != reinterpret_cast<const LinkedListPointers*>(&other) ? Clear().Append(std::move(other)) : *this;
+			if (this == reinterpret_cast<const LinkedListPointers*>(&other)) return *this;
+
+			Clear();
+			PropagateAllocator(other, typename AllocatorTraits::propagate_on_container_move_assignment());
+
+			return Append(std::move(other));
 		}
 
+		// The nodes that we already have are reused for the copy
 		inline auto& operator=(const LinkedListPointers& other)
 		{
-			return this != reinterpret_cast<const LinkedListPointers*>(&other) ? Clear().Append(other) : *this;
+			if (this == reinterpret_cast<const LinkedListPointers*>(&other)) return *this;
+
+			PropagateAllocator(other, typename AllocatorTraits::propagate_on_container_copy_assignment());
+
+			return Recycle().Append(other);
 		}
 
 		// Getters
 		inline auto Size() const { return size; }
 		inline auto IsEmpty() const { return size == 0; }
+		inline auto Capacity() const { return blocks.head ? blocks.head->capacity : 0u; }
+		inline auto GetAllocator() const { return Allocator(GetBlockAllocator()); }
 		inline auto begin() const { return *first; }
 		inline auto end() const { return dummy; }
 		inline auto Contains(const ElementType& element) const 
@@ -144,21 +266,32 @@ namespace containers
 			return last->data; 
 		}
 
+		inline auto& operator[](const Handle& handle)
+		{
+			if (!handle.node) throw USED_EMPTY_HANDLE;
+			return handle.node->data;
+		}
+
+		inline const auto& operator[](const Handle& handle) const
+		{
+			if (!handle.node) throw USED_EMPTY_HANDLE;
+			return handle.node->data;
+		}
+
 		// List Manipulation
 		auto& Append(ElementType element)
 		{
+			LinkedNode* newNode = AcquireNode(std::move(element));
+			newNode->next = &dummy;
+
 			if (size == 0)
 			{
-				LinkedNode* newNode = new LinkedNode(std::move(element), &dummy, &dummy);
-				if (!newNode) throw NEW_FAILED;
-
+				newNode->previous = &dummy;
 				first = last = newNode;
 			}
 			else
 			{
-				LinkedNode* newNode = new LinkedNode(std::move(element), &dummy, last);
-				if (!newNode) throw NEW_FAILED;
-
+				newNode->previous = last;
 				last->next = newNode;
 				last = last->next;
 			}
@@ -170,127 +303,203 @@ namespace containers
 		
 		auto& Append(const LinkedListPointers& other)
 		{
-			unsigned int count = 0;
+			// The size is taken first, so appending a list to itself stops at its original end
 			unsigned int otherSize = other.size;
+			Reserve(otherSize);
 
-			for (const auto& otherData : other)
+			for (auto current = other.first; otherSize > 0; current = current->next, otherSize--)
 			{
-				Append(otherData);
-
-				if (++count == otherSize)
-				{
-					break;
-				}
+				Append(current->data);
 			}
 
 			return *this;
 		}
 
+		// Takes over the nodes of 'other' along with the blocks that hold them, nothing is copied.
+		// When the allocators are different the blocks can't change hands, so only the elements are moved.
 		auto& Append(LinkedListPointers&& other)
 		{
 			if (&other == this)
 			{
 				Append(other);
 			}
+			else if (GetBlockAllocator() != other.GetBlockAllocator())
+			{
+				Reserve(other.size);
+				for (auto current = other.first; current != &dummy; current = current->next) Append(std::move(current->data));
+				other.Clear();
+			}
 			else
 			{
-				if (size == 0)
+				if (other.size != 0)
 				{
-					first = other.first;
+					if (size == 0)
+					{
+						first = other.first;
+					}
+					else
+					{
+						last->next = other.first;
+						other.first->previous = last;
+					}
+
 					last = other.last;
-				}
-				else
-				{
-					last->next = other.first;
-					other.first->previous = last;
+					size += other.size;
 				}
 
-				other.first = &dummy;
-				size += other.size;
+				AdoptStorage(other);
+				other.first = other.last = &dummy;
+				other.size = 0;
 			}
 
 			return *this;
 		}
 
 		template<typename BeginIteratorType, typename EndIteratorType>
-		auto& Append(const BeginIteratorType& begin, const EndIteratorType& end)
+		auto& Append(BeginIteratorType begin, EndIteratorType end)
 		{
+			return AppendRange(begin, end);
+		}
+
+		// Appends everything from 'begin' to 'end'. All the nodes are reserved up front in a single block (when 'sizeHint'
+		// is given, or when the iterators can tell the distance between them), and then linked one after the other.
+		template<typename BeginIteratorType, typename EndIteratorType>
+		auto& AppendRange(BeginIteratorType begin, EndIteratorType end, size_t sizeHint = 0)
+		{
+			Reserve(sizeHint != 0 ? sizeHint : GetDistance(begin, end, 0));
+
 			while (begin != end)
 			{
-				Append(*(begin++));
+				Append(*begin);
+				++begin;
 			}
+
+			return *this;
+		}
+
+		// Makes sure that the next 'count' elements can be added without allocating, using a single block
+		auto& Reserve(size_t count)
+		{
+			const size_t available = Capacity() - size;
+			if (count > available) AddBlock(count - available);
+
+			return *this;
 		}
 
 		template<typename Any>
 		inline auto& Prepend(Any&& other)
 		{
-			return *this = LinkedListPointers<ElementType>().Append(std::forward<Any>(other)).Append(std::move(*this));
+			return *this = std::move(LinkedListPointers(GetAllocator()).Append(std::forward<Any>(other)).Append(std::move(*this)));
 		}
 
 		template<typename BeginIteratorType, typename EndIteratorType>
 		auto& Prepend(const BeginIteratorType& begin, const EndIteratorType& end)
 		{
-			return *this = LinkedListPointers<ElementType>().Append(begin, end).Append(*this);
+			return *this = std::move(LinkedListPointers(GetAllocator()).Append(begin, end).Append(std::move(*this)));
 		}
 
 		template<typename Container>
 		inline auto& operator+=(Container&& other){ return Append(std::forward<Container>(other)); }
 
 		template<typename Container>
-		inline auto operator+(Container&& other){ return LinkedListPointers(*this).Append(std::forward<Container>(other)); }
+		inline auto operator+(Container&& other)
+		{
+			LinkedListPointers result(*this);
+			result.Append(std::forward<Container>(other));
+
+			return result;
+		}
 
+		// The node of every removed element is kept for reuse, see 'ShrinkToFit'
 		auto& Remove(const ElementType& element)
 		{
-			auto current = first;
+			// The element is copied, since it might be one of the elements that get removed
+			return RemoveIf([element](const ElementType& current) { return current == element; });
+		}
+
+		// Removes every element that 'predicate' accepts in a single pass.
+		// The remaining nodes are relinked as we go, and the removed ones are kept for reuse (see 'ShrinkToFit').
+		template<typename Predicate>
+		auto& RemoveIf(Predicate predicate)
+		{
+			LinkedNode* kept = &dummy;
+			LinkedNode* current = first;
+			first = &dummy;
 
 			while (current != &dummy)
 			{
-				if (current->data == element)
+				auto next = current->next;
+
+				if (predicate(current->data))
 				{
-					if (current == last)
-					{
-						last = current->previous;
-						last->next = &dummy;
-					}
+					ReleaseNode(current);
+					--size;
+				}
+				else
+				{
+					current->previous = kept;
+					if (kept == &dummy) first = current;
+					else kept->next = current;
+					kept = current;
+				}
 
-					if (current == first)
-					{
-						first = first->next;
-						first->previous = &dummy;
-					}
+				current = next;
+			}
+
+			last = kept;
+			if (kept != &dummy) kept->next = &dummy;
 
-					current->previous->next = current->next;
-					current->next->previous = current->previous;
+			return *this;
+		}
 
-					auto toDelete = current;
-					current = current->next;
-					delete toDelete;
+		// Removes every element that equals the one before it, in a single pass (on a sorted list this removes all duplicates).
+		// Like 'RemoveIf', the removed nodes are kept for reuse.
+		template<typename EqualityComparator = std::equal_to<ElementType>>
+		auto& Unique(EqualityComparator isEqual = EqualityComparator())
+		{
+			if (size < 2) return *this;
+
+			LinkedNode* kept = first;
+			LinkedNode* current = first->next;
+
+			while (current != &dummy)
+			{
+				auto next = current->next;
+
+				if (isEqual(kept->data, current->data))
+				{
+					ReleaseNode(current);
 					--size;
 				}
 				else
 				{
-					current = current->next;
+					kept->next = current;
+					current->previous = kept;
+					kept = current;
 				}
+
+				current = next;
 			}
 
+			last = kept;
+			last->next = &dummy;
+
 			return *this;
 		}
-		
+
 		auto& RemoveFirst()
 		{
 			if (IsEmpty()) throw REMOVED_ELEMENT_WHEN_EMPTY;
 			LinkedNode* toDelete = first;
 
 			first = first->next;
-			first->previous = &dummy;
 
-			delete toDelete;
-			--size;
+			// The dummy is shared by every list and compared by value in the iterators, so it's never written to
+			if (first != &dummy) first->previous = &dummy;
+			else last = &dummy;
 
-			if (size == 0)
-			{
-				last = &dummy;
-			}
+			ReleaseNode(toDelete);
+			--size;
 
 			return *this;
 		}
@@ -301,30 +510,180 @@ namespace containers
 			LinkedNode* toDelete = last;
 			
 			last = last->previous;
-			last->next = &dummy;
 
-			delete toDelete;
+			if (last != &dummy) last->next = &dummy;
+			else first = &dummy;
+
+			ReleaseNode(toDelete);
 			--size;
 
-			if (size == 0)
+			return *this;
+		}
+
+		// Appends the element and returns a handle to it, which 'Erase' can remove in O(1)
+		auto Insert(ElementType element)
+		{
+			Append(std::move(element));
+			return Handle(last);
+		}
+
+		// Inserts the element right before the one that 'before' stands for
+		auto Insert(const Handle& before, ElementType element)
+		{
+			if (!before.node) throw USED_EMPTY_HANDLE;
+
+			LinkedNode* newNode = AcquireNode(std::move(element));
+			newNode->next = before.node;
+			newNode->previous = before.node->previous;
+
+			if (newNode->previous == &dummy) first = newNode;
+			else newNode->previous->next = newNode;
+
+			before.node->previous = newNode;
+			++size;
+
+			return Handle(newNode);
+		}
+
+		// Removes just the element that 'handle' stands for, without looking at any other element.
+		// Like an iterator, the handle must still stand for an element of this list.
+		auto& Erase(const Handle& handle)
+		{
+			if (!handle.node) throw USED_EMPTY_HANDLE;
+			LinkedNode* toDelete = handle.node;
+
+			if (toDelete->previous != &dummy) toDelete->previous->next = toDelete->next;
+			else first = toDelete->next;
+
+			if (toDelete->next != &dummy) toDelete->next->previous = toDelete->previous;
+			else last = toDelete->previous;
+
+			ReleaseNode(toDelete);
+			--size;
+
+			return *this;
+		}
+
+		// Stable bottom-up merge sort, the nodes are relinked in place and nothing is allocated.
+		// Without a comparator, lists of unsigned integers are radix sorted instead.
+		auto& Sort() { return Sort(std::less<ElementType>(), IsRadixSortable()); }
+
+		template<typename Comparator>
+		auto& Sort(Comparator comparator)
+		{
+			if (size < 2) return *this;
+
+			// The sort works on a plain singly linked chain, the previous pointers are fixed at the end
+			last->next = nullptr;
+			LinkedNode* head = first;
+
+			for (unsigned int width = 1; width < size; width *= 2)
 			{
-				first = &dummy;
+				LinkedNode* remaining = head;
+				LinkedNode** tail = &head;
+
+				while (remaining)
+				{
+					LinkedNode* left = remaining;
+					LinkedNode* right = SplitChain(left, width);
+					remaining = SplitChain(right, width);
+
+					while (left && right)
+					{
+						// Taking from the left on ties keeps the sort stable
+						auto& taken = comparator(right->data, left->data) ? right : left;
+						*tail = taken;
+						tail = &taken->next;
+						taken = taken->next;
+					}
+
+					*tail = left ? left : right;
+					while (*tail) tail = &(*tail)->next;
+				}
 			}
 
-			return *this;
+			return RelinkChain(head);
+		}
+
+		// Stable LSD radix sort for unsigned integers, one byte at a time. Every pass deals the nodes into 256 buckets
+		// and chains the buckets back together, so it's O(n) per byte and only relinks nodes. Bytes above the largest
+		// element are skipped, so small numbers (like town numbers) take just a couple of passes.
+		auto& RadixSort()
+		{
+			static_assert(IsRadixSortable::value, "Radix sort only works on unsigned integers!");
+			if (size < 2) return *this;
+
+			ElementType largest = 0;
+			for (auto current = first; current != &dummy; current = current->next) if (current->data > largest) largest = current->data;
+
+			last->next = nullptr;
+			LinkedNode* head = first;
+
+			for (unsigned int shift = 0; shift < sizeof(ElementType) * 8 && (largest >> shift) != 0; shift += 8)
+			{
+				LinkedNode* bucketHeads[RADIX] = {};
+				LinkedNode** bucketTails[RADIX];
+				for (unsigned int bucket = 0; bucket < RADIX; bucket++) bucketTails[bucket] = &bucketHeads[bucket];
+
+				for (auto current = head; current; current = current->next)
+				{
+					const auto bucket = static_cast<unsigned int>((current->data >> shift) & (RADIX - 1));
+					*bucketTails[bucket] = current;
+					bucketTails[bucket] = &current->next;
+				}
+
+				LinkedNode** tail = &head;
+				for (unsigned int bucket = 0; bucket < RADIX; bucket++)
+				{
+					if (!bucketHeads[bucket]) continue;
+					*tail = bucketHeads[bucket];
+					tail = bucketTails[bucket];
+				}
+
+				*tail = nullptr;
+			}
+
+			return RelinkChain(head);
+		}
+
+		// Moves the elements into a single new block, in the order of the list, and frees the old blocks.
+		// A list that was built through appends and removes ends up with its nodes wherever the free nodes happened
+		// to be, so every step of a traversal may miss the cache; afterwards the traversal reads memory in order.
+		// The nodes that were kept for reuse are freed too, and every iterator is invalidated.
+		auto& Linearize()
+		{
+			LinkedListPointers linear(GetAllocator());
+			linear.Reserve(size);
+
+			for (auto current = first; current != &dummy; current = current->next) linear.Append(std::move(current->data));
+
+			return *this = std::move(linear);
+		}
+
+		// Gives back the nodes that were kept for reuse, by moving the elements into a single block of exactly their size.
+		// Nothing happens when no node is free, otherwise it invalidates every iterator and handle like 'Linearize'.
+		auto& ShrinkToFit()
+		{
+			if (Capacity() == size) return *this;
+			return Linearize();
 		}
 
 		auto& MakeEmpty() { return Clear(); }
 		auto& Clear()
 		{
-			while (first != &dummy)
+			// Every node lives in one of the blocks, so freeing the blocks frees everything
+			auto& allocator = GetBlockAllocator();
+			NodeAllocator nodeAllocator(allocator);
+			while (blocks.head)
 			{
-				auto toDelete = first;
-				first = first->next;
-				delete toDelete;
+				auto toDelete = blocks.head;
+				blocks.head = toDelete->next;
+
+				for (auto node = toDelete->GetNodes(); node != toDelete->GetNodes() + toDelete->count; ++node) NodeAllocatorTraits::destroy(nodeAllocator, node);
+				BlockAllocatorTraits::deallocate(allocator, toDelete, GetBlockLength(toDelete->count));
 			}
 
-			last = &dummy;
+			first = last = &dummy;
 			size = 0;
 
 			return *this;
@@ -335,6 +694,40 @@ namespace containers
 		static constexpr auto NEW_FAILED = "Failed to allocate memory with 'new'!";
 		static constexpr auto GET_ELEMENT_WHEN_EMPTY = "Can't get an element when the list is empty!";
 		static constexpr auto REMOVED_ELEMENT_WHEN_EMPTY = "Can't remove an element when the list is empty!";
+		static constexpr auto USED_EMPTY_HANDLE = "Can't use a handle that doesn't stand for any element!";
+
+		// Consts
+		static constexpr unsigned int RADIX = 256;
+		static constexpr size_t MAX_BLOCK_SIZE = 4096;
+		static constexpr size_t PREFETCH_DISTANCE = 16;	// Nodes, enough to cover a cache miss with a cheap step per node
+
+		// Subclasses
+		// Every block starts with a header and its nodes follow it, in the same allocation. The newest block is the head
+		// of the chain, and it also keeps the nodes that are free for reuse, so the list itself only needs a pointer to it.
+		struct alignas(LinkedNode) BlockHeader
+		{
+			BlockHeader* next;		// The block that was added before this one
+			LinkedNode* freeNodes;	// Chained through 'next', only the head of the chain has any
+			unsigned int count;		// The nodes of this block
+			unsigned int capacity;	// The nodes of this block and of all the blocks after it
+
+			inline auto GetNodes() { return reinterpret_cast<LinkedNode*>(this + 1); }
+		};
+
+		// Types
+		using AllocatorTraits = std::allocator_traits<Allocator>;
+		using NodeAllocator = typename AllocatorTraits::template rebind_alloc<LinkedNode>;
+		using NodeAllocatorTraits = std::allocator_traits<NodeAllocator>;
+		using BlockAllocator = typename AllocatorTraits::template rebind_alloc<BlockHeader>;
+		using BlockAllocatorTraits = std::allocator_traits<BlockAllocator>;
+
+		// The allocator is the base of the block chain, so an empty allocator doesn't take any room in the list
+		struct BlockChain : BlockAllocator
+		{
+			explicit BlockChain(const Allocator& allocator) : BlockAllocator(allocator), head(nullptr) { }
+
+			BlockHeader* head;
+		};
 
 		// Static Data Members
 		static LinkedNode dummy;
@@ -343,10 +736,195 @@ namespace containers
 		LinkedNode* first;
 		LinkedNode* last;
 		unsigned int size;
+		BlockChain blocks;
+
+		// Methods
+		inline auto& GetBlockAllocator() { return static_cast<BlockAllocator&>(blocks); }
+		inline const auto& GetBlockAllocator() const { return static_cast<const BlockAllocator&>(blocks); }
+
+		// How many headers' worth of memory a block of 'count' nodes takes, with its own header
+		static inline size_t GetBlockLength(size_t count)
+		{
+			return 1 + (count * sizeof(LinkedNode) + sizeof(BlockHeader) - 1) / sizeof(BlockHeader);
+		}
+
+		// Only a hint, on compilers that can't prefetch it does nothing
+		static inline void Prefetch(const void* address)
+		{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+			_mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#elif defined(__GNUC__)
+			__builtin_prefetch(address);
+#else
+			(void)address;
+#endif
+		}
+
+		void AddBlock(size_t count)
+		{
+			auto& allocator = GetBlockAllocator();
+			BlockHeader* block = BlockAllocatorTraits::allocate(allocator, GetBlockLength(count));
+			if (!block) throw NEW_FAILED;
+
+			// The new block becomes the head, so it takes over the free nodes of the old one
+			const auto previousHead = blocks.head;
+			::new (static_cast<void*>(block)) BlockHeader{ previousHead,
+														   previousHead ? previousHead->freeNodes : nullptr,
+														   static_cast<unsigned int>(count),
+														   static_cast<unsigned int>(count) + (previousHead ? previousHead->capacity : 0) };
+			if (previousHead) previousHead->freeNodes = nullptr;
+			blocks.head = block;
+
+			NodeAllocator nodeAllocator(allocator);
+			const auto nodes = block->GetNodes();
+			for (auto node = nodes; node != nodes + count; ++node) NodeAllocatorTraits::construct(nodeAllocator, node);
+
+			// Chained backwards, so the nodes are handed out in the order they sit in memory
+			for (auto node = nodes + count; node != nodes; )
+			{
+				--node;
+				node->next = block->freeNodes;
+				block->freeNodes = node;
+			}
+		}
+
+		LinkedNode* AcquireNode(ElementType element)
+		{
+			// The blocks double the capacity until they reach MAX_BLOCK_SIZE
+			const auto capacity = Capacity();
+			if (!blocks.head || !blocks.head->freeNodes) AddBlock(capacity == 0 ? 1 : capacity < MAX_BLOCK_SIZE ? capacity : MAX_BLOCK_SIZE);
+
+			auto& freeNodes = blocks.head->freeNodes;
+			LinkedNode* node = freeNodes;
+			freeNodes = freeNodes->next;
+			node->data = std::move(element);
+
+			return node;
+		}
+
+		void ReleaseNode(LinkedNode* node)
+		{
+			node->data = ElementType();
+			node->next = blocks.head->freeNodes;
+			blocks.head->freeNodes = node;
+		}
+
+		// Empties the list but keeps all of its nodes for reuse
+		auto& Recycle()
+		{
+			while (first != &dummy)
+			{
+				auto next = first->next;
+				ReleaseNode(first);
+				first = next;
+			}
+
+			last = &dummy;
+			size = 0;
+
+			return *this;
+		}
+
+		// The blocks of 'other' go in front of ours, so its head keeps the free nodes of both lists
+		void AdoptStorage(LinkedListPointers& other)
+		{
+			const auto otherHead = other.blocks.head;
+			other.blocks.head = nullptr;
+			if (!otherHead) return;
+
+			if (blocks.head)
+			{
+				const auto ourCapacity = blocks.head->capacity;
+				auto lastBlock = otherHead;
+				for (;; lastBlock = lastBlock->next)
+				{
+					lastBlock->capacity += ourCapacity;
+					if (!lastBlock->next) break;
+				}
+
+				lastBlock->next = blocks.head;
+
+				while (blocks.head->freeNodes)
+				{
+					auto node = blocks.head->freeNodes;
+					blocks.head->freeNodes = node->next;
+					node->next = otherHead->freeNodes;
+					otherHead->freeNodes = node;
+				}
+			}
+
+			blocks.head = otherHead;
+		}
+
+		// Our blocks can only be freed by the allocator that made them, so they're freed before it's replaced
+		void PropagateAllocator(const LinkedListPointers& other, std::true_type)
+		{
+			if (GetBlockAllocator() == other.GetBlockAllocator()) return;
+
+			Clear();
+			GetBlockAllocator() = other.GetBlockAllocator();
+		}
+
+		void PropagateAllocator(const LinkedListPointers&, std::false_type) { }
+
+		template<typename IteratorType>
+		static auto GetDistance(const IteratorType& begin, const IteratorType& end, int) -> decltype(static_cast<size_t>(end - begin))
+		{
+			return static_cast<size_t>(end - begin);
+		}
+
+		// Iterators that can't tell their distance don't reserve anything
+		template<typename BeginIteratorType, typename EndIteratorType>
+		static size_t GetDistance(const BeginIteratorType&, const EndIteratorType&, long) { return 0; }
+
+		// bool is unsigned too, but it has nothing to radix sort
+		using IsRadixSortable = std::integral_constant<bool, std::is_unsigned<ElementType>::value && !std::is_same<ElementType, bool>::value>;
+
+		template<typename Comparator>
+		inline auto& Sort(Comparator comparator, std::false_type) { return Sort(comparator); }
+
+		template<typename Comparator>
+		inline auto& Sort(Comparator, std::true_type) { return RadixSort(); }
+
+		// Cuts the chain after 'count' nodes, and returns the rest of it
+		static LinkedNode* SplitChain(LinkedNode* chain, unsigned int count)
+		{
+			for (unsigned int index = 1; chain && index < count; index++) chain = chain->next;
+			if (!chain) return nullptr;
+
+			auto rest = chain->next;
+			chain->next = nullptr;
+
+			return rest;
+		}
+
+		// Makes the list out of a null terminated chain of its own nodes
+		auto& RelinkChain(LinkedNode* head)
+		{
+			LinkedNode* previous = &dummy;
+			first = head;
+
+			for (auto current = head; current; current = current->next)
+			{
+				current->previous = previous;
+				previous = current;
+			}
+
+			last = previous;
+			last->next = &dummy;
+
+			return *this;
+		}
 	};
+
+	namespace pmr
+	{
+		template<typename ElementType>
+		using LinkedListPointers = containers::LinkedListPointers<ElementType, std::pmr::polymorphic_allocator<ElementType>>;
+	}
 }
 
-template<typename ElementType>
-typename containers::LinkedListPointers<ElementType>::LinkedNode containers::LinkedListPointers<ElementType>::dummy;
+template<typename ElementType, typename Allocator>
+typename containers::LinkedListPointers<ElementType, Allocator>::LinkedNode containers::LinkedListPointers<ElementType, Allocator>::dummy;
 
 #endif // !INCLUDE_DATASTRUCTURES_LINKEDLIST_LINKEDLISTPOINTERS__H
@@ -0,0 +1,244 @@
+#ifndef INCLUDE_DATASTRUCTURES_LINKEDLIST_PERSISTENTLIST__H
+#define INCLUDE_DATASTRUCTURES_LINKEDLIST_PERSISTENTLIST__H
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include "DataStructures/LinkedList/LinkedListPointers.h"
+#include "DataStructures/LinkedList/LinkedListArray.h"
+
+namespace containers
+{
+	// An immutable singly linked list whose nodes are shared between all the lists that reach them.
+	// Copying a list only copies a pointer, and prepending only adds a node in front of the shared ones, so both are O(1).
+	// Nodes are never changed once they're linked, and they're freed by an atomic reference count when the last list
+	// that reaches them is gone, so a copy is a snapshot that other threads can read while this list moves on.
+	template<typename ElementType>
+	class PersistentList
+	{
+	private:
+		// Subclasses
+		struct Node
+		{
+			Node(ElementType data, Node* next) : data(std::move(data)), next(next), references(1) { }
+
+			const ElementType data;
+			Node* next;	// Only ever set while the node is still private to the list that creates it
+			std::atomic<unsigned int> references;
+		};
+
+	public:
+		// Subclasses
+		class Iterator
+		{
+			// Friend Classes
+			friend class PersistentList;
+
+		private:
+			// Error Messages
+			static constexpr auto DEREFERENCED_INVALID_ITERATOR = "Can't dereference a dangling iterator!";
+			static constexpr auto INCREMENTED_INVALID_ITERATOR = "Can't increment a dangling iterator!";
+
+			// Members
+			const Node* node;
+
+			// C'tors
+			explicit Iterator(const Node* node) : node(node) { }
+
+		public:
+			// C'tors
+			Iterator() : node(nullptr) { }
+
+			// Iterator Methods
+			inline const auto& operator*() const
+			{
+				if (!node) throw DEREFERENCED_INVALID_ITERATOR;
+				return node->data;
+			}
+
+			inline auto& operator++()
+			{
+				if (!node) throw INCREMENTED_INVALID_ITERATOR;
+				node = node->next;
+				return *this;
+			}
+
+			auto operator++(int)
+			{
+				Iterator before = *this;
+				++(*this);
+
+				return before;
+			}
+
+			inline auto operator!=(const Iterator& other) const { return node != other.node; }
+			inline auto operator==(const Iterator& other) const { return node == other.node; }
+		};
+
+		// Constructors
+		PersistentList() : head(nullptr), size(0) { }
+		PersistentList(const PersistentList& other) : head(other.head), size(other.size) { Share(head); }
+		PersistentList(PersistentList&& other) noexcept : head(other.head), size(other.size)
+		{
+			other.head = nullptr;
+			other.size = 0;
+		}
+
+		// Builds the list in the order of the range, so any of the other containers can be turned into a persistent list
+		template<typename BeginIteratorType, typename EndIteratorType>
+		PersistentList(BeginIteratorType begin, EndIteratorType end) : PersistentList()
+		{
+			Node** tail = &head;
+
+			try
+			{
+				for (; begin != end; ++begin, ++size)
+				{
+					*tail = CreateNode(*begin, nullptr);
+					tail = &(*tail)->next;
+				}
+			}
+			catch (...)
+			{
+				Clear();
+				throw;
+			}
+		}
+
+		// Destructor
+		~PersistentList() { Clear(); }
+
+		// Assignment Operator Methods
+		auto& operator=(const PersistentList& other)
+		{
+			// Sharing first keeps the nodes alive when 'other' is a part of this list
+			Share(other.head);
+			Release(head);
+
+			head = other.head;
+			size = other.size;
+
+			return *this;
+		}
+
+		auto& operator=(PersistentList&& other) noexcept
+		{
+			if (&other == this) return *this;
+			Release(head);
+
+			head = other.head;
+			size = other.size;
+			other.head = nullptr;
+			other.size = 0;
+
+			return *this;
+		}
+
+		// Getters
+		inline auto Size() const { return size; }
+		inline auto IsEmpty() const { return size == 0; }
+		inline auto begin() const { return Iterator(head); }
+		inline auto end() const { return Iterator(); }
+		inline auto Contains(const ElementType& element) const
+		{
+			for (const auto& current : *this) if (current == element) return true;
+			return false;
+		}
+
+		inline const auto& First() const
+		{
+			if (IsEmpty()) throw GET_ELEMENT_WHEN_EMPTY;
+			return head->data;
+		}
+
+		// The list without its first element, sharing all of its nodes
+		auto Rest() const
+		{
+			if (IsEmpty()) throw GET_ELEMENT_WHEN_EMPTY;
+
+			PersistentList rest;
+			rest.head = head->next;
+			rest.size = size - 1;
+			Share(rest.head);
+
+			return rest;
+		}
+
+		// Conversions
+		inline auto ToLinkedListPointers() const { return LinkedListPointers<ElementType>(begin(), end(), size); }
+		inline auto ToLinkedListArray() const { return LinkedListArray<ElementType>(size, begin(), end()); }
+
+		// List Manipulation
+		// Only this list changes, every other list keeps seeing the nodes it had
+		auto& Prepend(ElementType element)
+		{
+			head = CreateNode(std::move(element), head);
+			++size;
+
+			return *this;
+		}
+
+		auto& RemoveFirst()
+		{
+			if (IsEmpty()) throw REMOVED_ELEMENT_WHEN_EMPTY;
+
+			auto removed = head;
+			head = head->next;
+			--size;
+
+			// The rest of the list is ours now, so the removed node must not release it
+			Share(head);
+			Release(removed);
+
+			return *this;
+		}
+
+		auto& MakeEmpty() { return Clear(); }
+		auto& Clear()
+		{
+			Release(head);
+			head = nullptr;
+			size = 0;
+
+			return *this;
+		}
+
+	private:
+		// Error Messages
+		static constexpr auto NEW_FAILED = "Failed to allocate memory with 'new'!";
+		static constexpr auto GET_ELEMENT_WHEN_EMPTY = "Can't get an element when the list is empty!";
+		static constexpr auto REMOVED_ELEMENT_WHEN_EMPTY = "Can't remove an element when the list is empty!";
+
+		// Data Members
+		Node* head;
+		unsigned int size;
+
+		// Methods
+		static Node* CreateNode(ElementType element, Node* next)
+		{
+			Node* node = new Node(std::move(element), next);
+			if (!node) throw NEW_FAILED;
+
+			return node;
+		}
+
+		// Sharing doesn't publish anything, so it needs no ordering
+		static void Share(const Node* node)
+		{
+			if (node) const_cast<Node*>(node)->references.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		// Frees the nodes that nobody else reaches. This is a loop rather than a recursion, so long lists can't overflow the stack.
+		static void Release(Node* node)
+		{
+			while (node && node->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				auto next = node->next;
+				delete node;
+				node = next;
+			}
+		}
+	};
+}
+
+#endif // !INCLUDE_DATASTRUCTURES_LINKEDLIST_PERSISTENTLIST__H
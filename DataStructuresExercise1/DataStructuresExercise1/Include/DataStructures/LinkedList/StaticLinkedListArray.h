@@ -0,0 +1,320 @@
+#ifndef INCLUDE_DATASTRUCTURES_LINKEDLIST_STATICLINKEDLISTARRAY__H
+#define INCLUDE_DATASTRUCTURES_LINKEDLIST_STATICLINKEDLISTARRAY__H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace containers
+{
+	// A LinkedListArray whose capacity is known at compile time. The elements and the links live in arrays inside the
+	// list itself, so it never allocates and can sit on the stack, and the links use the smallest unsigned type that
+	// can tell every slot apart (a list of up to 254 elements links its slots with single bytes).
+	// Everything is constexpr, so a list of literal types can also be built and used while compiling.
+	template<typename ElementType, std::size_t FixedCapacity>
+	class StaticLinkedListArray
+	{
+		static_assert(FixedCapacity > 0, "A static list needs room for at least one element!");
+		static_assert(FixedCapacity < UINT32_MAX, "A static list can't have that many slots!");
+
+	public:
+		// Types
+		// The largest value of the type marks a missing slot, so it can't be the index of one
+		using IndexType = std::conditional_t<(FixedCapacity < UINT8_MAX), std::uint8_t,
+						  std::conditional_t<(FixedCapacity < UINT16_MAX), std::uint16_t, std::uint32_t>>;
+
+		// Subclasses
+		class LinkedNode
+		{
+			// Friend Classes
+			friend class StaticLinkedListArray;
+
+		private:
+			// Error Messages
+			static constexpr auto DEREFERENCED_INVALID_ITERATOR = "Can't dereference a dangling iterator!";
+			static constexpr auto INCREMENTED_INVALID_ITERATOR = "Can't increment a dangling iterator!";
+			static constexpr auto DECREMENTED_INVALID_ITERATOR = "Can't decrement a dangling iterator!";
+
+			// Members
+			StaticLinkedListArray* container;
+			IndexType dataIndex;
+
+			// C'tors
+			constexpr LinkedNode(const StaticLinkedListArray& container, IndexType dataIndex)
+				: container(const_cast<StaticLinkedListArray*>(&container)), dataIndex(dataIndex) { }
+
+		public:
+			// C'tors
+			constexpr LinkedNode() : container(nullptr), dataIndex(NONEXISTENT_ELEMENT) { }
+
+			// Iterator Methods
+			constexpr auto& operator*()
+			{
+				if (dataIndex == NONEXISTENT_ELEMENT) throw DEREFERENCED_INVALID_ITERATOR;
+				return container->elements[dataIndex];
+			}
+
+			constexpr const auto& operator*() const
+			{
+				if (dataIndex == NONEXISTENT_ELEMENT) throw DEREFERENCED_INVALID_ITERATOR;
+				return container->elements[dataIndex];
+			}
+
+			constexpr auto& operator++()
+			{
+				if (dataIndex == NONEXISTENT_ELEMENT) throw INCREMENTED_INVALID_ITERATOR;
+				dataIndex = container->elementNexts[dataIndex];
+				return *this;
+			}
+
+			constexpr auto operator++(int)
+			{
+				LinkedNode before = *this;
+				++(*this);
+
+				return before;
+			}
+
+			constexpr auto& operator--()
+			{
+				if (dataIndex == NONEXISTENT_ELEMENT) throw DECREMENTED_INVALID_ITERATOR;
+				dataIndex = container->elementPrevs[dataIndex];
+				return *this;
+			}
+
+			constexpr auto operator--(int)
+			{
+				LinkedNode before = *this;
+				--(*this);
+
+				return before;
+			}
+
+			constexpr auto operator!=(const LinkedNode& other) const
+			{
+				return container != other.container || dataIndex != other.dataIndex;
+			}
+
+			constexpr auto operator==(const LinkedNode& other) const { return !(*this != other); }
+		};
+
+		// Constructors
+		constexpr StaticLinkedListArray() : elements(), elementNexts(), elementPrevs(), size(0), firstIndex(NONEXISTENT_ELEMENT), lastIndex(NONEXISTENT_ELEMENT), freeIndex(0)
+		{
+			for (std::size_t index = 0; index < FixedCapacity; index++)
+			{
+				elementNexts[index] = static_cast<IndexType>(index + 1);
+				elementPrevs[index] = NONEXISTENT_ELEMENT;
+			}
+		}
+
+		template<typename BeginIteratorType, typename EndIteratorType>
+		constexpr StaticLinkedListArray(BeginIteratorType begin, EndIteratorType end) : StaticLinkedListArray()
+		{
+			Append(begin, end);
+		}
+
+		// Getters
+		constexpr auto Size() const { return static_cast<unsigned int>(size); }
+		constexpr auto IsEmpty() const { return size == 0; }
+		static constexpr auto Capacity() { return FixedCapacity; }
+		constexpr auto begin() const { return LinkedNode(*this, firstIndex); }
+		constexpr auto end() const { return LinkedNode(*this, NONEXISTENT_ELEMENT); }
+		constexpr auto Contains(const ElementType& element) const
+		{
+			for (auto current = firstIndex; current != NONEXISTENT_ELEMENT; current = elementNexts[current])
+			{
+				if (elements[current] == element) return true;
+			}
+
+			return false;
+		}
+
+		constexpr auto& First()
+		{
+			if (IsEmpty()) throw GET_ELEMENT_WHEN_EMPTY;
+			return elements[firstIndex];
+		}
+
+		constexpr const auto& First() const
+		{
+			if (IsEmpty()) throw GET_ELEMENT_WHEN_EMPTY;
+			return elements[firstIndex];
+		}
+
+		constexpr auto& Last()
+		{
+			if (IsEmpty()) throw GET_ELEMENT_WHEN_EMPTY;
+			return elements[lastIndex];
+		}
+
+		constexpr const auto& Last() const
+		{
+			if (IsEmpty()) throw GET_ELEMENT_WHEN_EMPTY;
+			return elements[lastIndex];
+		}
+
+		// List Manipulation
+		constexpr auto& Append(ElementType element)
+		{
+			if (size == FixedCapacity) throw ADD_ELEMENT_WHEN_FULL;
+
+			const auto newIndex = freeIndex;
+			freeIndex = elementNexts[newIndex];
+
+			elements[newIndex] = std::move(element);
+			elementNexts[newIndex] = NONEXISTENT_ELEMENT;
+			elementPrevs[newIndex] = lastIndex;
+
+			if (size == 0) firstIndex = newIndex;
+			else elementNexts[lastIndex] = newIndex;
+
+			lastIndex = newIndex;
+			++size;
+
+			return *this;
+		}
+
+		template<std::size_t OtherFixedCapacity>
+		constexpr auto& Append(const StaticLinkedListArray<ElementType, OtherFixedCapacity>& other)
+		{
+			// The size is taken first, so appending a list to itself stops at its original end
+			auto otherSize = other.Size();
+			if (otherSize > FixedCapacity - size) throw ADD_ELEMENT_WHEN_FULL;
+
+			for (auto current = other.begin(); otherSize > 0; ++current, otherSize--) Append(*current);
+
+			return *this;
+		}
+
+		template<typename BeginIteratorType, typename EndIteratorType>
+		constexpr auto& Append(BeginIteratorType begin, EndIteratorType end)
+		{
+			while (begin != end)
+			{
+				Append(*begin);
+				++begin;
+			}
+
+			return *this;
+		}
+
+		template<typename Container>
+		constexpr auto& operator+=(const Container& other) { return Append(other); }
+
+		constexpr auto& Remove(const ElementType& element)
+		{
+			// The element is copied, since it might be one of the elements that get removed
+			return RemoveIf([element](const ElementType& current) { return current == element; });
+		}
+
+		// Removes every element that 'predicate' accepts in a single pass, relinking the remaining indices as we go
+		template<typename Predicate>
+		constexpr auto& RemoveIf(Predicate predicate)
+		{
+			IndexType kept = NONEXISTENT_ELEMENT;
+			IndexType current = firstIndex;
+			firstIndex = NONEXISTENT_ELEMENT;
+
+			while (current != NONEXISTENT_ELEMENT)
+			{
+				const auto next = elementNexts[current];
+
+				if (predicate(elements[current]))
+				{
+					DeleteIndex(current);
+				}
+				else
+				{
+					elementPrevs[current] = kept;
+					if (kept == NONEXISTENT_ELEMENT) firstIndex = current;
+					else elementNexts[kept] = current;
+					kept = current;
+				}
+
+				current = next;
+			}
+
+			lastIndex = kept;
+			if (kept != NONEXISTENT_ELEMENT) elementNexts[kept] = NONEXISTENT_ELEMENT;
+
+			return *this;
+		}
+
+		constexpr auto& RemoveFirst()
+		{
+			if (IsEmpty()) throw REMOVED_ELEMENT_WHEN_EMPTY;
+			const auto toDelete = firstIndex;
+			firstIndex = elementNexts[firstIndex];
+
+			if (size == 1) lastIndex = NONEXISTENT_ELEMENT;
+			else elementPrevs[firstIndex] = NONEXISTENT_ELEMENT;
+
+			DeleteIndex(toDelete);
+
+			return *this;
+		}
+
+		constexpr auto& RemoveLast()
+		{
+			if (IsEmpty()) throw REMOVED_ELEMENT_WHEN_EMPTY;
+			const auto toDelete = lastIndex;
+			lastIndex = elementPrevs[lastIndex];
+
+			if (size == 1) firstIndex = NONEXISTENT_ELEMENT;
+			else elementNexts[lastIndex] = NONEXISTENT_ELEMENT;
+
+			DeleteIndex(toDelete);
+
+			return *this;
+		}
+
+		constexpr auto& MakeEmpty() { return Clear(); }
+
+		// Only the slots in use go back to the free slots, so emptying a short list doesn't go over the whole capacity
+		constexpr auto& Clear()
+		{
+			while (firstIndex != NONEXISTENT_ELEMENT)
+			{
+				const auto next = elementNexts[firstIndex];
+				DeleteIndex(firstIndex);
+				firstIndex = next;
+			}
+
+			lastIndex = NONEXISTENT_ELEMENT;
+
+			return *this;
+		}
+
+	private:
+		// Error Messages
+		static constexpr auto GET_ELEMENT_WHEN_EMPTY = "Can't get an element when the list is empty!";
+		static constexpr auto REMOVED_ELEMENT_WHEN_EMPTY = "Can't remove an element when the list is empty!";
+		static constexpr auto ADD_ELEMENT_WHEN_FULL = "Not enough capacity to add an element to the list!";
+
+		// Consts
+		static constexpr auto NONEXISTENT_ELEMENT = static_cast<IndexType>(~IndexType(0));
+
+		// Data Members
+		std::array<ElementType, FixedCapacity> elements;
+		std::array<IndexType, FixedCapacity> elementNexts;
+		std::array<IndexType, FixedCapacity> elementPrevs;
+		IndexType size;
+		IndexType firstIndex;
+		IndexType lastIndex;
+		IndexType freeIndex;
+
+		// Methods
+		constexpr void DeleteIndex(IndexType deletedIndex)
+		{
+			elementNexts[deletedIndex] = freeIndex;
+			freeIndex = deletedIndex;
+			elements[deletedIndex] = ElementType();
+			--size;
+		}
+	};
+}
+
+#endif // !INCLUDE_DATASTRUCTURES_LINKEDLIST_STATICLINKEDLISTARRAY__H
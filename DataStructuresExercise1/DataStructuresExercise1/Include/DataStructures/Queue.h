@@ -0,0 +1,80 @@
+#ifndef INCLUDE_DATASTRUCTURES_QUEUE__H
+#define INCLUDE_DATASTRUCTURES_QUEUE__H
+
+#include <utility>
+#include "DataStructures/ContainerAdapter.h"
+#include "DataStructures/Deque.h"
+
+namespace containers
+{
+	// The queue works on any container with Append, First and RemoveFirst. When the container allocates,
+	// the queue allocates through it and takes whatever allocator the container was given.
+	template<typename ElementType, typename UnderlyingContainer = Deque<ElementType>>
+	class Queue : public details::ContainerAdapter<UnderlyingContainer>
+	{
+		// Types
+		using Base = details::ContainerAdapter<UnderlyingContainer>;
+
+	public:
+		// Constructors
+		Queue() = default;
+		template<typename Container = UnderlyingContainer>
+		explicit Queue(const details::AllocatorOf<Container>& allocator) : Base(allocator) { }
+		Queue(const Queue& other) = default;
+		template<typename Container = UnderlyingContainer>
+		Queue(const Queue& other, const details::AllocatorOf<Container>& allocator) : Base(other, allocator) { }
+		Queue(Queue&& other) = default;
+		template<typename Container = UnderlyingContainer>
+		Queue(Queue&& other, const details::AllocatorOf<Container>& allocator) : Base(std::move(other), allocator) { }
+
+		// Destructor
+		~Queue() = default;
+
+		// Assignment Operator Methods
+		Queue& operator=(const Queue& other) = default;
+		Queue& operator=(Queue&& other) = default;
+
+		// Getters
+		inline auto Size() const { return UnderlyingContainer::Size(); }
+		inline auto IsEmpty() const { return UnderlyingContainer::IsEmpty(); }
+		inline auto Front() const
+		{
+			if (IsEmpty()) throw GET_FRONT_WHEN_EMPTY;
+			return UnderlyingContainer::First();
+		}
+
+		// Queue Manipulation
+		inline auto& Enqueue(ElementType element)
+		{
+			try { return UnderlyingContainer::Append(std::move(element)); }
+			catch (const char*) { throw ENQUEUE_FAILED; }
+		}
+
+		inline auto Dequeue()
+		{
+			if (IsEmpty()) throw DEQUEUE_WHEN_EMPTY;
+			auto temp = Front(); UnderlyingContainer::RemoveFirst(); return temp;
+		}
+
+		// Makes room for 'count' elements, so a queue that never holds more than that never allocates
+		inline auto& Reserve(size_t count) { return UnderlyingContainer::Reserve(count); }
+
+		inline auto& MakeEmpty() { return UnderlyingContainer::MakeEmpty(); }
+		inline auto& Clear() { return UnderlyingContainer::Clear(); }
+
+	private:
+		// Error Messages
+		static constexpr auto GET_FRONT_WHEN_EMPTY = "Can't get the front of the queue when it's empty!";
+		static constexpr auto DEQUEUE_WHEN_EMPTY = "Can't dequeue when the queue is empty!";
+		static constexpr auto ENQUEUE_FAILED = "Failed to enqueue a new element to the queue!";
+	};
+
+	namespace pmr
+	{
+		template<typename ElementType, typename UnderlyingContainer = containers::pmr::Deque<ElementType>>
+		using Queue = containers::Queue<ElementType, UnderlyingContainer>;
+	}
+}
+
+
+#endif // !INCLUDE_DATASTRUCTURES_QUEUE__H
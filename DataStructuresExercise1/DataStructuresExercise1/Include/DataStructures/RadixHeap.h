@@ -0,0 +1,112 @@
+#ifndef INCLUDE_DATASTRUCTURES_RADIXHEAP__H
+#define INCLUDE_DATASTRUCTURES_RADIXHEAP__H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace containers
+{
+	// A monotone min heap for unsigned integer keys: a pushed key can never be lower than the last popped one,
+	// which always holds for the distances popped by Dijkstra. Keys are kept in buckets by the highest bit in which they
+	// differ from the last popped key, so a push is O(1) and every key moves down through at most 64 buckets in total.
+	// There's no decrease key, pushing the value again with the lower key and skipping the stale one later is cheaper.
+	template<typename ValueType>
+	class RadixHeap
+	{
+	public:
+		// Constructors
+		RadixHeap() : last(0), size(0) { }
+
+		// Getters
+		inline auto Size() const { return size; }
+		inline auto IsEmpty() const { return size == 0; }
+
+		// Heap Manipulation
+		auto& Push(std::uint64_t key, ValueType value)
+		{
+			if (key < last) throw KEY_BELOW_LAST;
+
+			buckets[GetBucket(key)].push_back({ key, std::move(value) });
+			++size;
+
+			return *this;
+		}
+
+		// Removes the entry with the lowest key
+		std::pair<std::uint64_t, ValueType> Pop()
+		{
+			if (IsEmpty()) throw POP_WHEN_EMPTY;
+
+			if (buckets[0].empty())
+			{
+				// The lowest key of the first non empty bucket is the new last key, and everything in that bucket
+				// shares more high bits with it than with the old one, so it all moves to lower buckets
+				unsigned int bucket = 1;
+				while (buckets[bucket].empty()) bucket++;
+
+				auto& entries = buckets[bucket];
+				last = entries[0].first;
+				for (const auto& entry : entries) if (entry.first < last) last = entry.first;
+
+				for (auto& entry : entries) buckets[GetBucket(entry.first)].push_back(std::move(entry));
+				entries.clear();
+			}
+
+			auto top = std::move(buckets[0].back());
+			buckets[0].pop_back();
+			--size;
+
+			return top;
+		}
+
+		auto& MakeEmpty()
+		{
+			for (auto& bucket : buckets) bucket.clear();
+			last = 0;
+			size = 0;
+
+			return *this;
+		}
+
+		auto& Clear() { return MakeEmpty(); }
+
+	private:
+		// Error Messages
+		static constexpr auto POP_WHEN_EMPTY = "Can't pop the heap when it's empty!";
+		static constexpr auto KEY_BELOW_LAST = "Can't push a key lower than the last popped one to a radix heap!";
+
+		// Consts
+		static constexpr unsigned int NUMBER_OF_BUCKETS = 65;
+
+		// Data Members
+		std::vector<std::pair<std::uint64_t, ValueType>> buckets[NUMBER_OF_BUCKETS];
+		std::uint64_t last;
+		size_t size;
+
+		// Methods
+		// Bucket 0 holds the keys equal to the last one, and bucket i the keys whose highest differing bit is bit i - 1
+		inline unsigned int GetBucket(std::uint64_t key) const
+		{
+			const auto difference = key ^ last;
+			if (difference == 0) return 0;
+
+#ifdef _MSC_VER
+			// Scanned in halves, so it also works on 32 bit targets
+			unsigned long index;
+			if (_BitScanReverse(&index, static_cast<unsigned long>(difference >> 32))) return index + 33;
+			_BitScanReverse(&index, static_cast<unsigned long>(difference));
+			return index + 1;
+#else
+			return 64 - __builtin_clzll(difference);
+#endif
+		}
+	};
+}
+
+#endif // !INCLUDE_DATASTRUCTURES_RADIXHEAP__H
@@ -0,0 +1,244 @@
+#ifndef INCLUDE_DATASTRUCTURES_SIMDSEARCH__H
+#define INCLUDE_DATASTRUCTURES_SIMDSEARCH__H
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CONTAINERS_SIMD_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CONTAINERS_SIMD_SSE2
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Finds an element among 64 elements that sit next to each other, and reports every match as a bit of a 64 bit mask.
+// Integers are compared with AVX2 or SSE2 when the compiler targets them (on MSVC, AVX2 needs /arch:AVX2),
+// and everything else, or any other target, is compared one element at a time.
+namespace containers
+{
+	namespace simd
+	{
+		// Consts
+		constexpr unsigned int BLOCK_SIZE = 64;
+
+		inline unsigned int CountBits(std::uint64_t bits)
+		{
+#if defined(_MSC_VER) && defined(_M_X64)
+			return static_cast<unsigned int>(__popcnt64(bits));
+#elif defined(__GNUC__)
+			return static_cast<unsigned int>(__builtin_popcountll(bits));
+#else
+			unsigned int count = 0;
+			for (; bits != 0; bits &= bits - 1) ++count;
+			return count;
+#endif
+		}
+
+		// 'bits' must not be 0
+		inline unsigned int GetLowestBit(std::uint64_t bits)
+		{
+#if defined(_MSC_VER)
+			// Scanned in halves, so it also works on 32 bit targets
+			unsigned long index;
+			if (_BitScanForward(&index, static_cast<unsigned long>(bits))) return index;
+			_BitScanForward(&index, static_cast<unsigned long>(bits >> 32));
+			return index + 32;
+#else
+			return static_cast<unsigned int>(__builtin_ctzll(bits));
+#endif
+		}
+
+		// Bit i is set when 'elements[i] == value', for the first 'count' elements (up to BLOCK_SIZE)
+		template<typename ElementType>
+		std::uint64_t MatchScalar(const ElementType* elements, unsigned int count, const ElementType& value)
+		{
+			std::uint64_t matches = 0;
+			for (unsigned int index = 0; index < count; index++)
+			{
+				if (elements[index] == value) matches |= std::uint64_t(1) << index;
+			}
+
+			return matches;
+		}
+
+		namespace details
+		{
+			// The integer types of every size, so the lanes can be filled with the bits of 'value'
+			template<unsigned int Size> struct Lane;
+			template<> struct Lane<1> { using Type = std::int8_t; };
+			template<> struct Lane<2> { using Type = std::int16_t; };
+			template<> struct Lane<4> { using Type = std::int32_t; };
+			template<> struct Lane<8> { using Type = std::int64_t; };
+
+			template<typename ElementType>
+			inline auto ToLane(const ElementType& value)
+			{
+				typename Lane<sizeof(ElementType)>::Type lane;
+				std::memcpy(&lane, &value, sizeof(lane));
+				return lane;
+			}
+
+#if defined(CONTAINERS_SIMD_AVX2)
+			inline std::uint64_t MatchBlock(const void* elements, std::int8_t value, std::integral_constant<unsigned int, 1>)
+			{
+				const auto needle = _mm256_set1_epi8(value);
+				const auto bytes = static_cast<const __m256i*>(elements);
+
+				const auto low = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(bytes), needle)));
+				const auto high = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(bytes + 1), needle)));
+
+				return low | (std::uint64_t(high) << 32);
+			}
+
+			inline std::uint64_t MatchBlock(const void* elements, std::int16_t value, std::integral_constant<unsigned int, 2>)
+			{
+				const auto needle = _mm256_set1_epi16(value);
+				const auto words = static_cast<const __m256i*>(elements);
+				std::uint64_t matches = 0;
+
+				// Packing two comparisons to bytes shuffles the 128 bit halves, which the permute puts back in order
+				for (unsigned int index = 0; index < BLOCK_SIZE / 32; index++)
+				{
+					const auto first = _mm256_cmpeq_epi16(_mm256_loadu_si256(words + 2 * index), needle);
+					const auto second = _mm256_cmpeq_epi16(_mm256_loadu_si256(words + 2 * index + 1), needle);
+					const auto packed = _mm256_permute4x64_epi64(_mm256_packs_epi16(first, second), 0xD8);
+					matches |= std::uint64_t(static_cast<std::uint32_t>(_mm256_movemask_epi8(packed))) << (index * 32);
+				}
+
+				return matches;
+			}
+
+			inline std::uint64_t MatchBlock(const void* elements, std::int32_t value, std::integral_constant<unsigned int, 4>)
+			{
+				const auto needle = _mm256_set1_epi32(value);
+				const auto lanes = static_cast<const __m256i*>(elements);
+				std::uint64_t matches = 0;
+
+				for (unsigned int index = 0; index < BLOCK_SIZE / 8; index++)
+				{
+					const auto equal = _mm256_cmpeq_epi32(_mm256_loadu_si256(lanes + index), needle);
+					matches |= std::uint64_t(static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(equal)))) << (index * 8);
+				}
+
+				return matches;
+			}
+
+			inline std::uint64_t MatchBlock(const void* elements, std::int64_t value, std::integral_constant<unsigned int, 8>)
+			{
+				const auto needle = _mm256_set1_epi64x(value);
+				const auto lanes = static_cast<const __m256i*>(elements);
+				std::uint64_t matches = 0;
+
+				for (unsigned int index = 0; index < BLOCK_SIZE / 4; index++)
+				{
+					const auto equal = _mm256_cmpeq_epi64(_mm256_loadu_si256(lanes + index), needle);
+					matches |= std::uint64_t(static_cast<unsigned int>(_mm256_movemask_pd(_mm256_castsi256_pd(equal)))) << (index * 4);
+				}
+
+				return matches;
+			}
+#elif defined(CONTAINERS_SIMD_SSE2)
+			inline std::uint64_t MatchBlock(const void* elements, std::int8_t value, std::integral_constant<unsigned int, 1>)
+			{
+				const auto needle = _mm_set1_epi8(value);
+				const auto bytes = static_cast<const __m128i*>(elements);
+				std::uint64_t matches = 0;
+
+				for (unsigned int index = 0; index < BLOCK_SIZE / 16; index++)
+				{
+					const auto equal = _mm_cmpeq_epi8(_mm_loadu_si128(bytes + index), needle);
+					matches |= std::uint64_t(static_cast<unsigned int>(_mm_movemask_epi8(equal))) << (index * 16);
+				}
+
+				return matches;
+			}
+
+			inline std::uint64_t MatchBlock(const void* elements, std::int16_t value, std::integral_constant<unsigned int, 2>)
+			{
+				const auto needle = _mm_set1_epi16(value);
+				const auto words = static_cast<const __m128i*>(elements);
+				std::uint64_t matches = 0;
+
+				for (unsigned int index = 0; index < BLOCK_SIZE / 16; index++)
+				{
+					const auto first = _mm_cmpeq_epi16(_mm_loadu_si128(words + 2 * index), needle);
+					const auto second = _mm_cmpeq_epi16(_mm_loadu_si128(words + 2 * index + 1), needle);
+					matches |= std::uint64_t(static_cast<unsigned int>(_mm_movemask_epi8(_mm_packs_epi16(first, second)))) << (index * 16);
+				}
+
+				return matches;
+			}
+
+			inline std::uint64_t MatchBlock(const void* elements, std::int32_t value, std::integral_constant<unsigned int, 4>)
+			{
+				const auto needle = _mm_set1_epi32(value);
+				const auto lanes = static_cast<const __m128i*>(elements);
+				std::uint64_t matches = 0;
+
+				for (unsigned int index = 0; index < BLOCK_SIZE / 4; index++)
+				{
+					const auto equal = _mm_cmpeq_epi32(_mm_loadu_si128(lanes + index), needle);
+					matches |= std::uint64_t(static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(equal)))) << (index * 4);
+				}
+
+				return matches;
+			}
+
+			// SSE2 can't compare 64 bit lanes, so both halves of a lane have to match
+			inline std::uint64_t MatchBlock(const void* elements, std::int64_t value, std::integral_constant<unsigned int, 8>)
+			{
+				const auto needle = _mm_set_epi32(static_cast<int>(value >> 32), static_cast<int>(value),
+												  static_cast<int>(value >> 32), static_cast<int>(value));
+				const auto lanes = static_cast<const __m128i*>(elements);
+				std::uint64_t matches = 0;
+
+				for (unsigned int index = 0; index < BLOCK_SIZE / 2; index++)
+				{
+					const auto halves = _mm_cmpeq_epi32(_mm_loadu_si128(lanes + index), needle);
+					const auto equal = _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+					matches |= std::uint64_t(static_cast<unsigned int>(_mm_movemask_pd(_mm_castsi128_pd(equal)))) << (index * 2);
+				}
+
+				return matches;
+			}
+#endif
+
+			template<typename ElementType>
+			inline std::uint64_t MatchBlock(const ElementType* elements, const ElementType& value, std::false_type)
+			{
+				return MatchScalar(elements, BLOCK_SIZE, value);
+			}
+
+			template<typename ElementType>
+			inline std::uint64_t MatchBlock(const ElementType* elements, const ElementType& value, std::true_type)
+			{
+				return MatchBlock(static_cast<const void*>(elements), ToLane(value), std::integral_constant<unsigned int, sizeof(ElementType)>());
+			}
+		}
+
+		// Integers are equal exactly when their bits are, so only they can be compared a vector at a time
+		template<typename ElementType>
+		struct IsVectorizable : std::integral_constant<bool,
+#if defined(CONTAINERS_SIMD_AVX2) || defined(CONTAINERS_SIMD_SSE2)
+			std::is_integral<ElementType>::value && !std::is_same<ElementType, bool>::value
+#else
+			false
+#endif
+		> { };
+
+		// Bit i is set when 'elements[i] == value', for the BLOCK_SIZE elements from 'elements'
+		template<typename ElementType>
+		inline std::uint64_t MatchBlock(const ElementType* elements, const ElementType& value)
+		{
+			return details::MatchBlock(elements, value, IsVectorizable<ElementType>());
+		}
+	}
+}
+
+#endif // !INCLUDE_DATASTRUCTURES_SIMDSEARCH__H
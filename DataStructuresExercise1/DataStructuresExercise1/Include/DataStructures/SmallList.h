@@ -0,0 +1,252 @@
+#ifndef INCLUDE_DATASTRUCTURES_SMALLLIST__H
+#define INCLUDE_DATASTRUCTURES_SMALLLIST__H
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace containers
+{
+	// A sequence that keeps its first 'InlineCapacity' elements inside the object itself, and only moves them to the heap
+	// once it grows beyond that. Short lists (like the roads of most towns) never allocate at all.
+	// The elements are contiguous, so the iterators are plain pointers.
+	template<typename ElementType, size_t InlineCapacity = 4>
+	class SmallList
+	{
+		static_assert(InlineCapacity > 0, "A small list needs room for at least one inline element!");
+
+	public:
+		// Constructors
+		SmallList() : size(0), capacity(static_cast<unsigned int>(InlineCapacity)) { }
+		SmallList(const SmallList& other) : SmallList() { Append(other); }
+		SmallList(SmallList&& other) noexcept : SmallList() { *this = std::move(other); }
+
+		template<typename BeginIteratorType, typename EndIteratorType>
+		SmallList(BeginIteratorType begin, EndIteratorType end) : SmallList() { AppendRange(begin, end); }
+
+		// Destructor
+		~SmallList() { Clear(); }
+
+		// Assignment Operator Methods
+		inline auto& operator=(const SmallList& other)
+		{
+			return &other != this ? MakeEmpty().Append(other) : *this;
+		}
+
+		auto& operator=(SmallList&& other) noexcept
+		{
+			if (&other == this) return *this;
+			Clear();
+
+			if (other.IsInline())
+			{
+				for (size_t index = 0; index < other.size; index++) new (InlineData() + index) ElementType(std::move(other.InlineData()[index]));
+				size = other.size;
+				other.MakeEmpty();
+			}
+			else
+			{
+				// Heap elements are taken over as they are
+				storage.heap = other.storage.heap;
+				size = other.size;
+				capacity = other.capacity;
+				other.size = 0;
+				other.capacity = static_cast<unsigned int>(InlineCapacity);
+			}
+
+			return *this;
+		}
+
+		// Getters
+		inline auto Size() const { return size; }
+		inline auto IsEmpty() const { return size == 0; }
+		inline auto Capacity() const { return capacity; }
+		inline auto IsInline() const { return capacity == InlineCapacity; }
+		inline auto begin() const { return static_cast<const ElementType*>(Data()); }
+		inline auto end() const { return begin() + size; }
+		inline auto begin() { return Data(); }
+		inline auto end() { return begin() + size; }
+		inline auto Contains(const ElementType& element) const
+		{
+			for (const auto& current : *this) if (current == element) return true;
+			return false;
+		}
+
+		inline auto& operator[](size_t index) { return Data()[index]; }
+		inline const auto& operator[](size_t index) const { return Data()[index]; }
+
+		inline auto& First()
+		{
+			if (IsEmpty()) throw GET_ELEMENT_WHEN_EMPTY;
+			return Data()[0];
+		}
+
+		inline const auto& First() const
+		{
+			if (IsEmpty()) throw GET_ELEMENT_WHEN_EMPTY;
+			return Data()[0];
+		}
+
+		inline auto& Last()
+		{
+			if (IsEmpty()) throw GET_ELEMENT_WHEN_EMPTY;
+			return Data()[size - 1];
+		}
+
+		inline const auto& Last() const
+		{
+			if (IsEmpty()) throw GET_ELEMENT_WHEN_EMPTY;
+			return Data()[size - 1];
+		}
+
+		// List Manipulation
+		auto& Append(ElementType element)
+		{
+			if (size == capacity) Reserve(capacity * 2);
+
+			new (Data() + size) ElementType(std::move(element));
+			++size;
+
+			return *this;
+		}
+
+		auto& Append(const SmallList& other)
+		{
+			// The size is taken first, so appending a list to itself stops at its original end
+			const auto otherSize = other.size;
+			Reserve(size + otherSize);
+
+			for (size_t index = 0; index < otherSize; index++) Append(other.Data()[index]);
+
+			return *this;
+		}
+
+		template<typename BeginIteratorType, typename EndIteratorType>
+		auto& AppendRange(BeginIteratorType begin, EndIteratorType end)
+		{
+			while (begin != end)
+			{
+				Append(*begin);
+				++begin;
+			}
+
+			return *this;
+		}
+
+		// Makes room for 'count' elements in total, moving them to the heap if they don't fit inline
+		auto& Reserve(size_t count)
+		{
+			if (count <= capacity) return *this;
+
+			auto* heap = static_cast<ElementType*>(::operator new(count * sizeof(ElementType)));
+			if (!heap) throw NEW_FAILED;
+
+			auto* elements = Data();
+			for (size_t index = 0; index < size; index++)
+			{
+				new (heap + index) ElementType(std::move(elements[index]));
+				elements[index].~ElementType();
+			}
+
+			if (!IsInline()) ::operator delete(storage.heap);
+			storage.heap = heap;
+			capacity = static_cast<unsigned int>(count);
+
+			return *this;
+		}
+
+		template<typename Container>
+		inline auto& operator+=(const Container& other) { return Append(other); }
+
+		template<typename Predicate>
+		auto& RemoveIf(Predicate predicate)
+		{
+			auto* elements = Data();
+			size_t kept = 0;
+
+			for (size_t index = 0; index < size; index++)
+			{
+				if (predicate(elements[index])) continue;
+				if (kept != index) elements[kept] = std::move(elements[index]);
+				++kept;
+			}
+
+			while (size > kept) elements[--size].~ElementType();
+
+			return *this;
+		}
+
+		auto& Remove(const ElementType& element)
+		{
+			// The element is copied, since it might be one of the elements that get removed
+			return RemoveIf([element](const ElementType& current) { return current == element; });
+		}
+
+		auto& RemoveFirst()
+		{
+			if (IsEmpty()) throw REMOVED_ELEMENT_WHEN_EMPTY;
+
+			auto* elements = Data();
+			for (size_t index = 1; index < size; index++) elements[index - 1] = std::move(elements[index]);
+			elements[--size].~ElementType();
+
+			return *this;
+		}
+
+		auto& RemoveLast()
+		{
+			if (IsEmpty()) throw REMOVED_ELEMENT_WHEN_EMPTY;
+			Data()[--size].~ElementType();
+
+			return *this;
+		}
+
+		// Removes the elements but keeps the memory
+		auto& MakeEmpty()
+		{
+			while (size > 0) Data()[--size].~ElementType();
+			return *this;
+		}
+
+		// Removes the elements and goes back to the inline storage
+		auto& Clear()
+		{
+			MakeEmpty();
+
+			if (!IsInline())
+			{
+				::operator delete(storage.heap);
+				capacity = static_cast<unsigned int>(InlineCapacity);
+			}
+
+			return *this;
+		}
+
+	private:
+		// Error Messages
+		static constexpr auto NEW_FAILED = "Failed to allocate memory with 'new'!";
+		static constexpr auto GET_ELEMENT_WHEN_EMPTY = "Can't get an element when the list is empty!";
+		static constexpr auto REMOVED_ELEMENT_WHEN_EMPTY = "Can't remove an element when the list is empty!";
+
+		// Data Members
+		union Storage
+		{
+			Storage() { }
+			~Storage() { }
+
+			alignas(ElementType) unsigned char inlineElements[InlineCapacity * sizeof(ElementType)];
+			ElementType* heap;
+		} storage;
+
+		unsigned int size;
+		unsigned int capacity;
+
+		// Methods
+		inline auto InlineData() { return reinterpret_cast<ElementType*>(storage.inlineElements); }
+		inline auto InlineData() const { return reinterpret_cast<const ElementType*>(storage.inlineElements); }
+		inline auto Data() { return IsInline() ? InlineData() : storage.heap; }
+		inline auto Data() const { return IsInline() ? InlineData() : static_cast<const ElementType*>(storage.heap); }
+	};
+}
+
+#endif // !INCLUDE_DATASTRUCTURES_SMALLLIST__H
@@ -1,18 +1,31 @@
 #ifndef INCLUDE_DATASTRUCTURES_STACK__H
 #define INCLUDE_DATASTRUCTURES_STACK__H
 
+#include <utility>
+#include "DataStructures/ContainerAdapter.h"
 #include "DataStructures/LinkedList/LinkedListPointers.h"
 
 namespace containers
 {
+	// The stack works on any container with Append, Last and RemoveLast. When the container allocates,
+	// the stack allocates through it and takes whatever allocator the container was given.
 	template<typename ElementType, typename UnderlyingContainer = LinkedListPointers<ElementType>>
-	class Stack : private UnderlyingContainer
+	class Stack : public details::ContainerAdapter<UnderlyingContainer>
 	{
+		// Types
+		using Base = details::ContainerAdapter<UnderlyingContainer>;
+
 	public:
 		// Constructors
 		Stack() = default;
+		template<typename Container = UnderlyingContainer>
+		explicit Stack(const details::AllocatorOf<Container>& allocator) : Base(allocator) { }
 		Stack(const Stack& other) = default;
+		template<typename Container = UnderlyingContainer>
+		Stack(const Stack& other, const details::AllocatorOf<Container>& allocator) : Base(other, allocator) { }
 		Stack(Stack&& other) = default;
+		template<typename Container = UnderlyingContainer>
+		Stack(Stack&& other, const details::AllocatorOf<Container>& allocator) : Base(std::move(other), allocator) { }
 
 		// Destructor
 		~Stack() = default;
@@ -52,6 +65,12 @@ namespace containers
 		static constexpr auto POP_WHEN_EMPTY = "Can't pop the stack when it's empty!";
 		static constexpr auto PUSH_FAILED = "Failed to push a new element to the stack!";
 	};
+
+	namespace pmr
+	{
+		template<typename ElementType, typename UnderlyingContainer = containers::pmr::LinkedListPointers<ElementType>>
+		using Stack = containers::Stack<ElementType, UnderlyingContainer>;
+	}
 }
 
 
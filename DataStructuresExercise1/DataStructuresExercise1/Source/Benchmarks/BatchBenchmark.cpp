@@ -0,0 +1,115 @@
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <streambuf>
+#include <thread>
+#include "Benchmarks/Benchmarks.h"
+#include "Country/BatchQueries.h"
+#include "Country/Generator.h"
+#include "Country/UserIO.h"
+
+using namespace std;
+
+namespace
+{
+	// Throws the output away but keeps a hash of it, so the runs can be compared without holding their output
+	class HashingBuffer : public streambuf
+	{
+	public:
+		// Getters
+		inline auto GetHash() const { return hash; }
+
+	protected:
+		int_type overflow(int_type character) override
+		{
+			if (character != traits_type::eof()) Add(static_cast<char>(character));
+			return character;
+		}
+
+		streamsize xsputn(const char* characters, streamsize count) override
+		{
+			for (streamsize index = 0; index < count; index++) Add(characters[index]);
+			return count;
+		}
+
+	private:
+		// Data Members
+		uint64_t hash = 14695981039346656037ull;
+
+		// Methods
+		inline void Add(char character)
+		{
+			hash = (hash ^ static_cast<unsigned char>(character)) * 1099511628211ull;
+		}
+	};
+}
+
+void benchmarks::RunBatchBenchmark(const vector<string>& arguments)
+{
+	if (arguments.size() < 2) throw "Usage: --benchmark batch <shape> <towns> [roads] [seed] [queries] [max workers]";
+
+	const auto shape = generator::ParseShape(arguments[0]);
+	const auto numberOfTowns = generator::ParseNumberOfTowns(arguments[1]);
+	const auto numberOfRoads = arguments.size() > 2 ? stoull(arguments[2]) : 0ull;
+	const auto seed = arguments.size() > 3 ? stoull(arguments[3]) : 1ull;
+	const auto numberOfQueries = arguments.size() > 4 ? static_cast<unsigned int>(stoul(arguments[4])) : 200u;
+	const auto maxWorkers = arguments.size() > 5 ? static_cast<unsigned int>(stoul(arguments[5])) : max(thread::hardware_concurrency(), 1u);
+
+	const auto country = GetCountryFromUserInput(generator::GenerateUserInput(shape, numberOfTowns, numberOfRoads, seed));
+
+	generator::Random random(seed + 1);
+	vector<int64_t> queries(numberOfQueries);
+	for (auto& query : queries) query = static_cast<int64_t>(random.Below(numberOfTowns)) + 1;
+
+	cout << arguments[0] << " country of " << numberOfTowns << " towns, " << numberOfQueries << " queries\n";
+
+	// What every query costs one at a time, through the regular traversal and printing
+	uint64_t expectedHash;
+	{
+		HashingBuffer buffer;
+		ostream output(&buffer);
+
+		const auto seconds = MeasureSeconds([&]()
+		{
+			for (const auto query : queries)
+			{
+				output << "Cities accessible from source city " << query << " (iterative algorithm): ";
+				PrintAccessibleTowns(iterative::GetToTown(country, static_cast<unsigned int>(query - 1)), output);
+			}
+		});
+
+		expectedHash = buffer.GetHash();
+		cout << "one by one:\t" << seconds << "s\t" << numberOfQueries / seconds << " queries per second\n";
+	}
+
+	// Doubling the workers up to the maximum
+	vector<unsigned int> workerCounts;
+	for (unsigned int workers = 1; workers < maxWorkers; workers *= 2) workerCounts.push_back(workers);
+	workerCounts.push_back(maxWorkers);
+
+	double singleWorkerSeconds = 0;
+	for (const auto workers : workerCounts)
+	{
+		HashingBuffer buffer;
+		ostream output(&buffer);
+		size_t next = 0;
+
+		const auto seconds = MeasureSeconds([&]()
+		{
+			batch::AnswerQueries(country, [&](int64_t& townNumber)
+			{
+				if (next == queries.size()) return false;
+
+				townNumber = queries[next++];
+				return true;
+			}, output, workers);
+		});
+
+		if (buffer.GetHash() != expectedHash) throw "The batch output is different from the one by one output!";
+		if (workers == 1) singleWorkerSeconds = seconds;
+
+		cout << workers << " workers:\t" << seconds << "s\t" << numberOfQueries / seconds << " queries per second\tspeedup x"
+			 << singleWorkerSeconds / seconds << "\n";
+	}
+}
@@ -0,0 +1,62 @@
+
+#include <cstdio>
+#include "Benchmarks/Benchmarks.h"
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#endif
+
+std::size_t benchmarks::GetPeakMemoryBytes()
+{
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS counters;
+	if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return 0;
+	return counters.PeakWorkingSetSize;
+#else
+	rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+	return static_cast<std::size_t>(usage.ru_maxrss);
+#else
+	return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+std::size_t benchmarks::GetStackBytes()
+{
+#ifdef _WIN32
+	ULONG_PTR low, high;
+	GetCurrentThreadStackLimits(&low, &high);
+	return static_cast<std::size_t>(high - low);
+#else
+	rlimit limit;
+	if (getrlimit(RLIMIT_STACK, &limit) != 0 || limit.rlim_cur == RLIM_INFINITY) return 0;
+	return static_cast<std::size_t>(limit.rlim_cur);
+#endif
+}
+
+benchmarks::TemporaryFile::~TemporaryFile()
+{
+	std::remove(path.c_str());
+}
+
+void benchmarks::RunBenchmark(const std::string& name, const std::vector<std::string>& arguments)
+{
+	if (name == "reordering") RunReorderingBenchmark(arguments);
+	else if (name == "scaling") RunScalingBenchmark(arguments);
+	else if (name == "compression") RunCompressionBenchmark(arguments);
+	else if (name == "external") RunExternalBenchmark(arguments);
+	else if (name == "dijkstra") RunShortestPathsBenchmark(arguments);
+	else if (name == "batch") RunBatchBenchmark(arguments);
+	else if (name == "linearize") RunLinearizeBenchmark(arguments);
+	else if (name == "dynamic") RunDynamicBenchmark(arguments);
+	else if (name == "search") RunSearchBenchmark(arguments);
+	else if (name == "build") RunBuildBenchmark(arguments);
+	else throw "Unknown benchmark! (expected reordering, scaling, compression, external, dijkstra, batch, linearize, dynamic, search or build)";
+}
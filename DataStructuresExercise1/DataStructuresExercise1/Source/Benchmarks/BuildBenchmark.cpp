@@ -0,0 +1,79 @@
+
+#include <algorithm>
+#include <iostream>
+#include <thread>
+#include "Benchmarks/Benchmarks.h"
+#include "Country/Country.h"
+#include "Country/Generator.h"
+
+using namespace std;
+using namespace generator;
+
+namespace
+{
+	bool AreEqual(const CsrCountry& first, const CsrCountry& second)
+	{
+		if (first.Size() != second.Size() || first.NumberOfEdges() != second.NumberOfEdges()) return false;
+
+		for (size_t town = 0; town < first.Size(); town++)
+		{
+			const auto firstRoads = first[town];
+			const auto secondRoads = second[town];
+			if (!equal(firstRoads.begin(), firstRoads.end(), secondRoads.begin(), secondRoads.end())) return false;
+		}
+
+		return true;
+	}
+}
+
+void benchmarks::RunBuildBenchmark(const vector<string>& arguments)
+{
+	if (arguments.size() < 2) throw "Usage: --benchmark build <shape> <towns> [roads] [seed] [max workers] [repetitions]";
+
+	const auto shape = ParseShape(arguments[0]);
+	const auto numberOfTowns = ParseNumberOfTowns(arguments[1]);
+	const auto numberOfRoads = arguments.size() > 2 ? stoull(arguments[2]) : 0ull;
+	const auto seed = arguments.size() > 3 ? stoull(arguments[3]) : 1ull;
+	const auto maxWorkers = arguments.size() > 4 ? static_cast<unsigned int>(stoul(arguments[4])) : max(thread::hardware_concurrency(), 1u);
+	const auto repetitions = arguments.size() > 5 ? static_cast<unsigned int>(stoul(arguments[5])) : 3u;
+
+	const auto userInput = GenerateUserInput(shape, numberOfTowns, numberOfRoads, seed);
+
+	cout << arguments[0] << " country of " << numberOfTowns << " towns and " << userInput.pairs.size() << " roads, "
+		 << thread::hardware_concurrency() << " hardware threads\n";
+
+	{
+		Country country;
+		const auto seconds = MeasureSeconds([&]()
+		{
+			for (unsigned int repetition = 0; repetition < repetitions; repetition++) country = GetCountryFromUserInput(userInput);
+		}) / repetitions;
+
+		cout << "lists:\t\t\t" << seconds << "s\n";
+	}
+
+	// Every number of workers has to lay the roads out exactly like a single worker does
+	for (const auto isSortedAndUnique : { false, true })
+	{
+		const auto expected = GetCsrCountryFromUserInput(userInput, 1, isSortedAndUnique);
+		double singleWorkerSeconds = 0;
+
+		for (unsigned int workers = 1; workers <= maxWorkers; workers = workers < maxWorkers ? min(workers * 2, maxWorkers) : workers + 1)
+		{
+			CsrCountry country;
+			const auto seconds = MeasureSeconds([&]()
+			{
+				for (unsigned int repetition = 0; repetition < repetitions; repetition++)
+				{
+					country = GetCsrCountryFromUserInput(userInput, workers, isSortedAndUnique);
+				}
+			}) / repetitions;
+
+			if (!AreEqual(country, expected)) throw "The workers laid the roads out differently!";
+			if (workers == 1) singleWorkerSeconds = seconds;
+
+			cout << (isSortedAndUnique ? "csr sorted" : "csr") << ", " << workers << " workers:\t" << seconds << "s\t("
+				 << singleWorkerSeconds / seconds << "x)\n";
+		}
+	}
+}
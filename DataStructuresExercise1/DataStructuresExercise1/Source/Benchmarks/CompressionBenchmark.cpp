@@ -0,0 +1,104 @@
+
+#include <algorithm>
+#include <iostream>
+#include "Benchmarks/Benchmarks.h"
+#include "Country/Country.h"
+#include "Country/Generator.h"
+
+using namespace std;
+using namespace generator;
+
+namespace
+{
+	// Roughly what the allocator hands out per node (the node itself plus its bookkeeping)
+	constexpr size_t ALLOCATION_OVERHEAD = 16;
+
+	auto GetSortedTowns(const containers::LinkedListArray<unsigned int>& accessibleTowns)
+	{
+		vector<unsigned int> towns;
+		towns.reserve(accessibleTowns.Size());
+		for (const auto& town : accessibleTowns) towns.push_back(town);
+		sort(towns.begin(), towns.end());
+
+		return towns;
+	}
+
+	template<typename CountryType>
+	void MeasureCountry(const char* name,
+						const CountryType& country,
+						double buildSeconds,
+						size_t memoryBytes,
+						size_t numberOfRoads,
+						unsigned int source,
+						unsigned int repetitions,
+						const vector<unsigned int>& expectedTowns)
+	{
+		containers::LinkedListArray<unsigned int> accessibleTowns;
+		const auto traversalSeconds = benchmarks::MeasureSeconds([&]()
+		{
+			for (unsigned int repetition = 0; repetition < repetitions; repetition++)
+			{
+				accessibleTowns = iterative::GetToTown(country, source);
+			}
+		}) / repetitions;
+
+		if (!expectedTowns.empty() && GetSortedTowns(accessibleTowns) != expectedTowns) throw "Traversal reached different towns!";
+
+		cout << name << ":\tbuild " << buildSeconds << "s\t" << memoryBytes / (1024 * 1024) << "MB ("
+			 << static_cast<double>(memoryBytes) / numberOfRoads << " bytes per road)\tdfs " << traversalSeconds << "s\n";
+	}
+}
+
+void benchmarks::RunCompressionBenchmark(const vector<string>& arguments)
+{
+	if (arguments.size() < 2) throw "Usage: --benchmark compression <shape> <towns> [roads] [seed] [repetitions]";
+
+	const auto shape = ParseShape(arguments[0]);
+	const auto numberOfTowns = ParseNumberOfTowns(arguments[1]);
+	const auto numberOfRoads = arguments.size() > 2 ? stoull(arguments[2]) : 0ull;
+	const auto seed = arguments.size() > 3 ? stoull(arguments[3]) : 1ull;
+	const auto repetitions = arguments.size() > 4 ? static_cast<unsigned int>(stoul(arguments[4])) : 3u;
+
+	const auto userInput = GenerateUserInput(shape, numberOfTowns, numberOfRoads, seed);
+	const auto source = userInput.source - 1;
+	const auto roads = max<size_t>(userInput.pairs.size(), 1);
+
+	cout << arguments[0] << " country of " << numberOfTowns << " towns and " << userInput.pairs.size() << " roads\n";
+
+	vector<unsigned int> expectedTowns;
+	{
+		Country country;
+		const auto buildSeconds = MeasureSeconds([&]() { country = GetCountryFromUserInput(userInput); });
+		const auto memoryBytes = country.capacity() * sizeof(Country::value_type) +
+								 userInput.pairs.size() * (sizeof(Country::value_type::LinkedNode) + ALLOCATION_OVERHEAD);
+
+		expectedTowns = GetSortedTowns(iterative::GetToTown(country, source));
+		MeasureCountry("lists", country, buildSeconds, memoryBytes, roads, source, repetitions, expectedTowns);
+	}
+
+	{
+		SmallCountry country;
+		const auto buildSeconds = MeasureSeconds([&]() { country = GetCountryFromUserInput<SmallCountry>(userInput); });
+
+		// Only the towns that outgrew the inline storage own any memory besides the vector itself
+		auto memoryBytes = country.capacity() * sizeof(SmallCountry::value_type);
+		for (const auto& town : country)
+		{
+			if (!town.IsInline()) memoryBytes += town.Capacity() * sizeof(unsigned int) + ALLOCATION_OVERHEAD;
+		}
+
+		MeasureCountry("small", country, buildSeconds, memoryBytes, roads, source, repetitions, expectedTowns);
+	}
+
+	{
+		CompressedCountry<containers::codecs::Varint> country;
+		const auto buildSeconds = MeasureSeconds([&]() { country = GetCompressedCountryFromUserInput<containers::codecs::Varint>(userInput); });
+		MeasureCountry("varint", country, buildSeconds, country.MemoryBytes(), roads, source, repetitions, expectedTowns);
+	}
+
+	{
+		CompressedCountry<containers::codecs::GroupVarint> country;
+		const auto buildSeconds = MeasureSeconds([&]() { country = GetCompressedCountryFromUserInput<containers::codecs::GroupVarint>(userInput); });
+		MeasureCountry("group", country, buildSeconds, country.MemoryBytes(), roads, source, repetitions, expectedTowns);
+	}
+}
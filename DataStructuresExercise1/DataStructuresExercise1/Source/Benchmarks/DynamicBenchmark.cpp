@@ -0,0 +1,104 @@
+
+#include <iostream>
+#include "Benchmarks/Benchmarks.h"
+#include "Country/DynamicCountry.h"
+#include "Country/Generator.h"
+
+using namespace std;
+using namespace generator;
+
+void benchmarks::RunDynamicBenchmark(const vector<string>& arguments)
+{
+	if (arguments.size() < 2) throw "Usage: --benchmark dynamic <shape> <towns> [roads] [seed] [updates per round] [rounds]";
+
+	const auto shape = ParseShape(arguments[0]);
+	const auto numberOfTowns = ParseNumberOfTowns(arguments[1]);
+	const auto numberOfRoads = arguments.size() > 2 ? stoull(arguments[2]) : 0ull;
+	const auto seed = arguments.size() > 3 ? stoull(arguments[3]) : 1ull;
+	const auto updates = arguments.size() > 4 ? static_cast<unsigned int>(stoul(arguments[4])) : 1000u;
+	const auto rounds = arguments.size() > 5 ? static_cast<unsigned int>(stoul(arguments[5])) : 10u;
+
+	const auto userInput = GenerateUserInput(shape, numberOfTowns, numberOfRoads, seed);
+	const auto source = userInput.source - 1;
+	if (userInput.pairs.empty()) throw "The country needs at least one road to tear down!";
+
+	cout << arguments[0] << " country of " << numberOfTowns << " towns and " << userInput.pairs.size() << " roads, "
+		 << rounds << " rounds of " << updates << " roads torn down and built\n";
+
+	// Both countries go through the same roads: the dynamic one tears a road down by its handle,
+	// while the plain one has to look for it among the neighbors of its source
+	auto country = GetCountryFromUserInput(userInput);
+	DynamicCountry<> dynamicCountry(numberOfTowns);
+
+	vector<DynamicCountry<>::Road> roads;
+	roads.reserve(userInput.pairs.size());
+	for (const auto& pair : userInput.pairs) roads.push_back(dynamicCountry.BuildRoad(pair.source - 1, pair.destination - 1));
+
+	// The towns of every road (zero based), so the plain country knows which road to look for
+	auto roadTowns = userInput.pairs;
+	for (auto& towns : roadTowns)
+	{
+		--towns.source;
+		--towns.destination;
+	}
+
+	struct Update
+	{
+		size_t road;
+		UserInput::Pair oldTowns;
+		UserInput::Pair newTowns;
+	};
+
+	Random random(seed + 1);
+	vector<Update> roundUpdates(updates);
+	double handleSeconds = 0, scanSeconds = 0, traversalSeconds = 0;
+
+	for (unsigned int round = 0; round < rounds; round++)
+	{
+		// Every update tears down a random road and builds a new one in its place
+		// (a road may be replaced more than once in a round)
+		for (auto& update : roundUpdates)
+		{
+			update.road = random.Below(roads.size());
+			update.oldTowns = roadTowns[update.road];
+			update.newTowns.source = static_cast<unsigned int>(random.Below(numberOfTowns));
+			update.newTowns.destination = static_cast<unsigned int>(random.Below(numberOfTowns));
+			roadTowns[update.road] = update.newTowns;
+		}
+
+		scanSeconds += MeasureSeconds([&]()
+		{
+			for (const auto& update : roundUpdates)
+			{
+				// Only one of the roads between the two towns is torn down
+				bool isFound = false;
+				country[update.oldTowns.source].RemoveIf([&](unsigned int neighbor)
+				{
+					if (isFound || neighbor != update.oldTowns.destination) return false;
+					return isFound = true;
+				});
+
+				country[update.newTowns.source].Append(update.newTowns.destination);
+			}
+		});
+
+		handleSeconds += MeasureSeconds([&]()
+		{
+			for (const auto& update : roundUpdates)
+			{
+				dynamicCountry.TearDownRoad(roads[update.road]);
+				roads[update.road] = dynamicCountry.BuildRoad(update.newTowns.source, update.newTowns.destination);
+			}
+		});
+
+		containers::LinkedListArray<unsigned int> dynamicTowns;
+		traversalSeconds += MeasureSeconds([&]() { dynamicTowns = iterative::GetToTown(dynamicCountry.GetCountry(), source); });
+
+		if (dynamicTowns.Size() != iterative::GetToTown(country, source).Size()) throw "The countries reached different towns!";
+	}
+
+	const auto numberOfUpdates = max(static_cast<double>(updates) * rounds, 1.0);
+	cout << "handles:\t" << handleSeconds / numberOfUpdates << "s per update\n"
+		 << "scans:\t\t" << scanSeconds / numberOfUpdates << "s per update\n"
+		 << "dfs:\t\t" << traversalSeconds / max(rounds, 1u) << "s per round\n";
+}
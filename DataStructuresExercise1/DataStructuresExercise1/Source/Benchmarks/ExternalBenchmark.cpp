@@ -0,0 +1,63 @@
+
+#include <fstream>
+#include <iostream>
+#include "Benchmarks/Benchmarks.h"
+#include "Country/Country.h"
+#include "Country/ExternalReachability.h"
+#include "Country/Generator.h"
+#include "Country/UserIO.h"
+
+using namespace std;
+using namespace generator;
+
+void benchmarks::RunExternalBenchmark(const vector<string>& arguments)
+{
+	if (arguments.size() < 2) throw "Usage: --benchmark external <shape> <towns> [roads] [seed] [budget KB] [file]";
+
+	const auto shape = ParseShape(arguments[0]);
+	const auto numberOfTowns = ParseNumberOfTowns(arguments[1]);
+	const auto numberOfRoads = arguments.size() > 2 ? stoull(arguments[2]) : 0ull;
+	const auto seed = arguments.size() > 3 ? stoull(arguments[3]) : 1ull;
+	const auto memoryBudget = (arguments.size() > 4 ? stoull(arguments[4]) : 4096ull) * 1024;
+
+	// The files are removed however the benchmark ends, and by default they go to the temporary directory
+	const TemporaryFile inputFile(arguments.size() > 5 ? arguments[5] : external::GetTemporaryPath("external-country", ".txt"));
+	const TemporaryFile roadsFile(inputFile.GetPath() + ".roads");
+	const auto& inputPath = inputFile.GetPath();
+	const auto& roadsPath = roadsFile.GetPath();
+
+	cout << arguments[0] << " country of " << numberOfTowns << " towns and " << GetNumberOfRoads(shape, numberOfTowns, numberOfRoads)
+		 << " roads, memory budget " << memoryBudget / 1024 << "KB\n";
+
+	{
+		ofstream input(inputPath, ios::binary);
+		WriteCountry(input, shape, numberOfTowns, numberOfRoads, seed);
+	}
+
+	// The external traversal runs first, so the peak memory it reports isn't hidden by the in-memory one
+	external::ExternalCountry externalCountry;
+	const auto sortSeconds = MeasureSeconds([&]()
+	{
+		ifstream input(inputPath, ios::binary);
+		externalCountry = external::CreateExternalCountry(input, roadsPath, memoryBudget);
+	});
+
+	vector<uint64_t> visited;
+	const auto traversalSeconds = MeasureSeconds([&]() { visited = external::GetToTown(externalCountry, externalCountry.source - 1, memoryBudget); });
+	cout << "external:\tsort " << sortSeconds << "s\ttraversal " << traversalSeconds << "s\tpeak memory "
+		 << GetPeakMemoryBytes() / (1024 * 1024) << "MB" << endl;
+
+	ifstream input(inputPath, ios::binary);
+	const auto userInput = GetUserInput(input);
+	const auto country = GetCountryFromUserInput(userInput);
+
+	containers::LinkedListArray<unsigned int> accessibleTowns;
+	const auto iterativeSeconds = MeasureSeconds([&]() { accessibleTowns = iterative::GetToTown(country, userInput.source - 1); });
+	cout << "iterative:\ttraversal " << iterativeSeconds << "s\tpeak memory " << GetPeakMemoryBytes() / (1024 * 1024) << "MB\n";
+
+	// Both have to reach exactly the same towns
+	vector<uint64_t> expected(visited.size(), 0);
+	for (const auto& town : accessibleTowns) expected[town / 64] |= uint64_t(1) << (town % 64);
+	if (expected != visited) throw "The external traversal reached different towns!";
+	cout << accessibleTowns.Size() << " accessible towns, both traversals agree\n";
+}
@@ -0,0 +1,107 @@
+
+#include <cstdint>
+#include <iostream>
+#include "Benchmarks/Benchmarks.h"
+#include "Country/Generator.h"
+#include "DataStructures/LinkedList/LinkedListPointers.h"
+
+using namespace std;
+
+namespace
+{
+	using List = containers::LinkedListPointers<unsigned int>;
+
+	// Every round removes a random half of the list and appends as many new elements, which take the freed nodes
+	// in the reverse order of their removal. After a few rounds the order of the list has little to do with memory.
+	List BuildWithChurn(unsigned int numberOfElements, unsigned int rounds, uint64_t seed)
+	{
+		generator::Random random(seed);
+		List list;
+		unsigned int nextElement = 0;
+
+		while (nextElement < numberOfElements) list.Append(nextElement++);
+
+		for (unsigned int round = 0; round < rounds; round++)
+		{
+			const auto sizeBefore = list.Size();
+			list.RemoveIf([&](unsigned int) { return random.Below(2) == 0; });
+			while (list.Size() < sizeBefore) list.Append(nextElement++);
+		}
+
+		return list;
+	}
+
+	template<typename Walk>
+	void MeasureWalk(const char* name, double preparationSeconds, unsigned int repetitions, uint64_t expectedSum, Walk walk)
+	{
+		uint64_t sum = 0;
+		const auto walkSeconds = benchmarks::MeasureSeconds([&]()
+		{
+			for (unsigned int repetition = 0; repetition < repetitions; repetition++) sum += walk();
+		}) / repetitions;
+
+		if (sum != expectedSum * repetitions) throw "A walk saw different elements!";
+
+		cout << name << ":\tprepare " << preparationSeconds << "s\twalk " << walkSeconds << "s\n";
+	}
+}
+
+void benchmarks::RunLinearizeBenchmark(const vector<string>& arguments)
+{
+	if (arguments.empty()) throw "Usage: --benchmark linearize <elements> [churn rounds] [seed] [repetitions]";
+
+	const auto numberOfElements = static_cast<unsigned int>(stoul(arguments[0]));
+	const auto rounds = arguments.size() > 1 ? static_cast<unsigned int>(stoul(arguments[1])) : 4u;
+	const auto seed = arguments.size() > 2 ? stoull(arguments[2]) : 1ull;
+	const auto repetitions = arguments.size() > 3 ? static_cast<unsigned int>(stoul(arguments[3])) : 5u;
+
+	auto list = BuildWithChurn(numberOfElements, rounds, seed);
+
+	uint64_t expectedSum = 0;
+	for (const auto& element : list) expectedSum += element;
+
+	const auto sumByIterators = [&]()
+	{
+		uint64_t sum = 0;
+		for (const auto& element : list) sum += element;
+		return sum;
+	};
+
+	cout << "list of " << numberOfElements << " elements after " << rounds << " rounds of churn\n";
+
+	MeasureWalk("iterators", 0, repetitions, expectedSum, sumByIterators);
+
+	{
+		// The first walk records the addresses for the ones after it, so it costs as much as a walk through the iterators
+		List::SkipPointers skipPointers(list);
+		const auto recordSeconds = MeasureSeconds([&]() { skipPointers.ForEach([](unsigned int) {}); });
+
+		const auto sumBySkipPointers = [&]()
+		{
+			uint64_t sum = 0;
+			skipPointers.ForEach([&](unsigned int element) { sum += element; });
+			return sum;
+		};
+
+		MeasureWalk("prefetched", recordSeconds, repetitions, expectedSum, sumBySkipPointers);
+
+		// A change shifts the addresses after it, so the first walk after it prefetches the wrong nodes and records them again
+		generator::Random random(seed + 1);
+		const auto sizeBefore = list.Size();
+		unsigned int nextElement = numberOfElements * (rounds + 1);
+		list.RemoveIf([&](unsigned int) { return random.Below(100) == 0; });
+		while (list.Size() < sizeBefore) list.Append(nextElement++);
+
+		expectedSum = 0;
+		for (const auto& element : list) expectedSum += element;
+
+		uint64_t sumAfterChange = 0;
+		const auto rerecordSeconds = MeasureSeconds([&]() { sumAfterChange = sumBySkipPointers(); });
+		if (sumAfterChange != expectedSum) throw "A walk saw different elements!";
+
+		MeasureWalk("changed 1%", rerecordSeconds, repetitions, expectedSum, sumBySkipPointers);
+	}
+
+	const auto linearizeSeconds = MeasureSeconds([&]() { list.Linearize(); });
+	MeasureWalk("linearized", linearizeSeconds, repetitions, expectedSum, sumByIterators);
+}
@@ -0,0 +1,82 @@
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include "Benchmarks/Benchmarks.h"
+#include "Country/Country.h"
+#include "Country/Generator.h"
+#include "Country/Reordering.h"
+
+using namespace std;
+using namespace reordering;
+
+namespace
+{
+	// A road-like grid with shuffled town numbers, with the roads also typed in a random order
+	UserInput GetShuffledGrid(unsigned int width, unsigned int seed)
+	{
+		auto userInput = generator::GenerateUserInput(generator::Shape::GRID, width * width, 0, seed);
+		shuffle(userInput.pairs.begin(), userInput.pairs.end(), mt19937(seed));
+
+		return userInput;
+	}
+
+	auto AreEqual(const containers::LinkedListArray<unsigned int>& first, const containers::LinkedListArray<unsigned int>& second)
+	{
+		if (first.Size() != second.Size()) return false;
+
+		auto secondIterator = second.begin();
+		for (const auto& town : first)
+		{
+			if (town != *(secondIterator++)) return false;
+		}
+
+		return true;
+	}
+}
+
+void benchmarks::RunReorderingBenchmark(const vector<string>& arguments)
+{
+	const auto width = arguments.size() > 0 ? stoul(arguments[0]) : 700u;
+	const auto repetitions = arguments.size() > 1 ? stoul(arguments[1]) : 5u;
+	const auto seed = arguments.size() > 2 ? stoul(arguments[2]) : 1u;
+
+	const auto userInput = GetShuffledGrid(static_cast<unsigned int>(width), static_cast<unsigned int>(seed));
+	const auto country = GetCountryFromUserInput(userInput);
+	const auto source = userInput.source - 1;
+	const auto expected = iterative::GetToTown(country, source);
+
+	cout << "Grid of " << userInput.numberOfTowns << " towns and " << userInput.pairs.size() << " roads, "
+		 << repetitions << " traversals per strategy\n";
+
+	double baselineSeconds = 0;
+	for (const auto strategy : { Strategy::NONE, Strategy::BFS, Strategy::REVERSE_CUTHILL_MCKEE, Strategy::DEGREE_SORTED })
+	{
+		Relabeling relabeling;
+		Country relabeled;
+
+		const auto relabelSeconds = MeasureSeconds([&]()
+		{
+			relabeling = ComputeRelabeling(country, strategy);
+			if (strategy != Strategy::NONE) relabeled = Relabel(country, relabeling);
+		});
+
+		// The baseline runs on the country as it was built from the input
+		const auto& traversed = strategy == Strategy::NONE ? country : relabeled;
+
+		containers::LinkedListArray<unsigned int> accessibleTowns;
+		const auto traversalSeconds = MeasureSeconds([&]()
+		{
+			for (unsigned int repetition = 0; repetition < repetitions; repetition++)
+			{
+				accessibleTowns = iterative::GetToTown(traversed, relabeling.ToNew(source));
+			}
+		}) / repetitions;
+
+		if (strategy == Strategy::NONE) baselineSeconds = traversalSeconds;
+		if (!AreEqual(RestoreOriginalTowns(accessibleTowns, relabeling), expected)) throw "Relabeled traversal returned different towns!";
+
+		cout << GetStrategyName(strategy) << ":\trelabel " << relabelSeconds << "s\tdfs " << traversalSeconds
+			 << "s\tspeedup x" << baselineSeconds / traversalSeconds << "\n";
+	}
+}
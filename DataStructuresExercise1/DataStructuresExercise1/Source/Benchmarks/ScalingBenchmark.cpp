@@ -0,0 +1,139 @@
+
+#include <fstream>
+#include <iostream>
+#include <utility>
+#include "Benchmarks/Benchmarks.h"
+#include "Country/Country.h"
+#include "Country/ExternalReachability.h"
+#include "Country/Generator.h"
+#include "Country/UserIO.h"
+
+using namespace std;
+using namespace generator;
+
+namespace
+{
+	// Consts
+	// A frame of the recursive traversal takes about 100 bytes in an optimized build, but several times that in a debug
+	// or sanitized one, so the default limit leaves room for frames ten times larger than that
+	constexpr size_t STACK_BYTES_PER_FRAME = 1024;
+	constexpr size_t UNKNOWN_STACK_RECURSION_DEPTH = 10000;
+
+	// How deep the recursive traversal may go before it's skipped, unless the command line says otherwise
+	size_t GetDefaultRecursionDepth()
+	{
+		const auto stackBytes = benchmarks::GetStackBytes();
+		return stackBytes == 0 ? UNKNOWN_STACK_RECURSION_DEPTH : stackBytes / STACK_BYTES_PER_FRAME;
+	}
+
+	// How deep the recursive traversal would go from 'source' (the number of its frames on the stack at the worst moment)
+	size_t GetRecursionDepth(const Country& country, unsigned int source)
+	{
+		vector<Color> coloredTowns(country.size(), WHITE);
+		vector<pair<unsigned int, containers::LinkedListPointers<unsigned int>::LinkedNode>> path;
+		size_t depth = 0;
+
+		coloredTowns[source] = BLACK;
+		path.emplace_back(source, country[source].begin());
+
+		while (!path.empty())
+		{
+			depth = max(depth, path.size());
+			auto& current = path.back();
+
+			while (current.second != country[current.first].end() && coloredTowns[*current.second] != WHITE)
+			{
+				++current.second;
+			}
+
+			if (current.second == country[current.first].end())
+			{
+				path.pop_back();
+			}
+			else
+			{
+				const auto neighbor = *current.second;
+				coloredTowns[neighbor] = BLACK;
+				path.emplace_back(neighbor, country[neighbor].begin());
+			}
+		}
+
+		return depth;
+	}
+
+	void PrintPhase(const char* phase, double seconds)
+	{
+		cout << phase << ":\t" << seconds << "s\tpeak memory " << benchmarks::GetPeakMemoryBytes() / (1024 * 1024) << "MB" << endl;
+	}
+}
+
+void benchmarks::RunScalingBenchmark(const vector<string>& arguments)
+{
+	if (arguments.size() < 2) throw "Usage: --benchmark scaling <shape> <towns> [roads] [seed] [max recursion depth] [file]";
+
+	const auto shape = ParseShape(arguments[0]);
+	const auto numberOfTowns = ParseNumberOfTowns(arguments[1]);
+	const auto numberOfRoads = arguments.size() > 2 ? stoull(arguments[2]) : 0ull;
+	const auto seed = arguments.size() > 3 ? stoull(arguments[3]) : 1ull;
+	const auto maxRecursionDepth = arguments.size() > 4 ? static_cast<size_t>(stoull(arguments[4])) : GetDefaultRecursionDepth();
+
+	// The files are removed however the benchmark ends, and by default they go to the temporary directory
+	const TemporaryFile inputFile(arguments.size() > 5 ? arguments[5] : external::GetTemporaryPath("scaling-country", ".txt"));
+	const TemporaryFile outputFile(inputFile.GetPath() + ".out");
+	const auto& inputPath = inputFile.GetPath();
+	const auto& outputPath = outputFile.GetPath();
+
+	cout << arguments[0] << " country of " << numberOfTowns << " towns and "
+		 << GetNumberOfRoads(shape, numberOfTowns, numberOfRoads) << " roads\n";
+
+	PrintPhase("generate", MeasureSeconds([&]()
+	{
+		ofstream input(inputPath, ios::binary);
+		WriteCountry(input, shape, numberOfTowns, numberOfRoads, seed);
+	}));
+
+	UserInput userInput;
+	PrintPhase("parse", MeasureSeconds([&]()
+	{
+		ifstream input(inputPath, ios::binary);
+		userInput = GetUserInput(input);
+	}));
+
+	Country country;
+	PrintPhase("build", MeasureSeconds([&]() { country = GetCountryFromUserInput(userInput); }));
+
+	// Only the country is needed from now on
+	const auto source = userInput.source - 1;
+	userInput = UserInput();
+
+	// Printed ahead of time, so it's visible even when the recursive traversal overflows the stack
+	const auto depth = GetRecursionDepth(country, source);
+	cout << "traversal depth " << depth << endl;
+
+	if (depth > maxRecursionDepth)
+	{
+		cout << "recursive:\tskipped, it would need " << depth << " nested calls and the stack only has room for about "
+			 << maxRecursionDepth << " (a larger limit can be passed after the seed)\n";
+	}
+	else
+	{
+		PrintPhase("recursive", MeasureSeconds([&]()
+		{
+			containers::LinkedListArray<unsigned int> accessibleTowns(country.size());
+			vector<Color> coloredTowns(country.size(), WHITE);
+			recursive::GetToTown(country, source, coloredTowns, accessibleTowns);
+		}));
+	}
+
+	containers::LinkedListArray<unsigned int> accessibleTowns;
+	PrintPhase("iterative", MeasureSeconds([&]() { accessibleTowns = iterative::GetToTown(country, source); }));
+	PrintPhase("breadth first", MeasureSeconds([&]() { breadthfirst::GetToTown(country, source); }));
+
+	PrintPhase("print", MeasureSeconds([&]()
+	{
+		ofstream output(outputPath, ios::binary);
+		PrintAccessibleTowns(accessibleTowns, output);
+	}));
+
+	cout << accessibleTowns.Size() << " accessible towns\n";
+}
@@ -0,0 +1,65 @@
+
+#include <cstdint>
+#include <iostream>
+#include "Benchmarks/Benchmarks.h"
+#include "Country/Generator.h"
+#include "DataStructures/LinkedList/LinkedListArray.h"
+
+using namespace std;
+
+void benchmarks::RunSearchBenchmark(const vector<string>& arguments)
+{
+	if (arguments.empty()) throw "Usage: --benchmark search <elements> [queries] [seed]";
+
+	const auto numberOfElements = static_cast<unsigned int>(stoul(arguments[0]));
+	const auto numberOfQueries = arguments.size() > 1 ? static_cast<unsigned int>(stoul(arguments[1])) : 100u;
+	const auto seed = arguments.size() > 2 ? stoull(arguments[2]) : 1ull;
+
+	// A quarter of the slots are freed again, so the searches have free slots to skip and the order of the list
+	// isn't the order of the slots
+	generator::Random random(seed);
+	containers::LinkedListArray<unsigned int> list(numberOfElements);
+	for (unsigned int element = 0; element < numberOfElements; element++) list.Append(static_cast<unsigned int>(random.Below(numberOfElements)));
+	list.RemoveIf([&](unsigned int) { return random.Below(4) == 0; });
+
+	// Half of the queries are for elements that were never added
+	vector<unsigned int> queries(numberOfQueries);
+	for (auto& query : queries) query = static_cast<unsigned int>(random.Below(2 * static_cast<uint64_t>(numberOfElements)));
+
+	cout << "list of " << list.Size() << " elements in " << list.Capacity() << " slots, " << numberOfQueries << " queries ("
+		 << (containers::simd::IsVectorizable<unsigned int>::value ? "vectorized" : "scalar") << ")\n";
+
+	uint64_t walkedCount = 0, scannedCount = 0, walkedFound = 0, scannedFound = 0;
+
+	const auto walkSeconds = MeasureSeconds([&]()
+	{
+		for (const auto query : queries)
+		{
+			bool isFound = false;
+			for (const auto& element : list)
+			{
+				if (element == query)
+				{
+					isFound = true;
+					break;
+				}
+			}
+
+			walkedFound += isFound;
+		}
+
+		for (const auto query : queries) for (const auto& element : list) walkedCount += element == query;
+	});
+
+	const auto scanSeconds = MeasureSeconds([&]()
+	{
+		for (const auto query : queries) scannedFound += list.Contains(query);
+		for (const auto query : queries) scannedCount += list.Count(query);
+	});
+
+	if (walkedFound != scannedFound || walkedCount != scannedCount) throw "The searches found different elements!";
+
+	const auto numberOfSearches = max(2.0 * numberOfQueries, 1.0);
+	cout << "walk:\t" << walkSeconds / numberOfSearches << "s per search\n"
+		 << "scan:\t" << scanSeconds / numberOfSearches << "s per search\n";
+}
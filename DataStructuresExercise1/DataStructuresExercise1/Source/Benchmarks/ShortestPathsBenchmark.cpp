@@ -0,0 +1,58 @@
+
+#include <iostream>
+#include "Benchmarks/Benchmarks.h"
+#include "Country/Generator.h"
+#include "Country/ShortestPaths.h"
+
+using namespace std;
+using namespace dijkstra;
+
+void benchmarks::RunShortestPathsBenchmark(const vector<string>& arguments)
+{
+	if (arguments.size() < 2) throw "Usage: --benchmark dijkstra <shape> <towns> [roads] [seed] [max weight] [queries]";
+
+	const auto shape = generator::ParseShape(arguments[0]);
+	const auto numberOfTowns = generator::ParseNumberOfTowns(arguments[1]);
+	const auto numberOfRoads = arguments.size() > 2 ? stoull(arguments[2]) : 0ull;
+	const auto seed = arguments.size() > 3 ? stoull(arguments[3]) : 1ull;
+	const auto maxWeight = arguments.size() > 4 ? static_cast<unsigned int>(stoul(arguments[4])) : 100u;
+	const auto numberOfQueries = arguments.size() > 5 ? static_cast<unsigned int>(stoul(arguments[5])) : 100u;
+
+	const auto userInput = generator::GenerateWeightedUserInput(shape, numberOfTowns, numberOfRoads, seed, maxWeight);
+	const auto country = GetWeightedCountryFromUserInput(userInput);
+	const auto source = userInput.source - 1;
+
+	// The same random (source, target) pairs for every heap. The seed of the roads would pick the roads themselves as the pairs.
+	generator::Random random(seed + 1);
+	vector<pair<unsigned int, unsigned int>> queries(numberOfQueries);
+	for (auto& query : queries)
+	{
+		query.first = static_cast<unsigned int>(random.Below(numberOfTowns));
+		query.second = static_cast<unsigned int>(random.Below(numberOfTowns));
+	}
+
+	cout << arguments[0] << " country of " << numberOfTowns << " towns and " << userInput.roads.size() << " roads (weights 1 to " << maxWeight
+		 << "), " << numberOfQueries << " single target queries\n";
+
+	const auto expectedCosts = GetCostsWithNaiveHeap(country, source);
+	vector<uint64_t> expectedTargetCosts;
+	for (const auto& query : queries) expectedTargetCosts.push_back(GetCostsWithNaiveHeap(country, query.first, query.second)[query.second]);
+
+	for (const auto heap : { Heap::NAIVE, Heap::DARY, Heap::RADIX })
+	{
+		vector<uint64_t> costs;
+		const auto allTownsSeconds = MeasureSeconds([&]() { costs = GetCosts(country, source, ALL_TOWNS, heap); });
+		if (costs != expectedCosts) throw "A heap found different costs!";
+
+		// Every query stops as soon as its target is settled
+		vector<uint64_t> targetCosts;
+		const auto singleTargetSeconds = MeasureSeconds([&]()
+		{
+			for (const auto& query : queries) targetCosts.push_back(GetCosts(country, query.first, query.second, heap)[query.second]);
+		}) / max<size_t>(queries.size(), 1);
+
+		if (targetCosts != expectedTargetCosts) throw "A heap found different costs!";
+
+		cout << GetHeapName(heap) << ":\tall towns " << allTownsSeconds << "s\tsingle target " << singleTargetSeconds << "s per query\n";
+	}
+}
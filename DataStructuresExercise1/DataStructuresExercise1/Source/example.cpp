@@ -1,6 +1,9 @@
 
+#include <memory_resource>
 #include "DataStructures/LinkedList/LinkedListPointers.h"
 #include "DataStructures/LinkedList/LinkedListArray.h"
+#include "DataStructures/LinkedList/PersistentList.h"
+#include "DataStructures/LinkedList/StaticLinkedListArray.h"
 #include "DataStructures/Stack.h"
 
 void LinkedListWithPointersExample()
@@ -64,6 +67,25 @@ void LinkedListWithPointersExample()
 	{
 		currentNumber++;
 	}
+
+	// Sort the list in place. Only the links between the nodes change, nothing is copied or allocated
+	myList.Sort();
+
+	// You can also give it your own comparison, like sorting from the biggest number to the smallest
+	myList.Sort([](int first, int second) { return first > second; });
+
+	// Remove all of the duplicates (after sorting, all of the duplicates are next to each other)
+	myList.Unique();
+
+	// Remove every number that matches a condition, in one go over the list
+	myList.RemoveIf([](int currentNumber) { return currentNumber % 2 == 0; });
+
+	// The removed nodes are kept for the next appends, this gives their memory back
+	myList.ShrinkToFit();
+
+	// Build a list from any range. When the size of the range is known, all of the nodes are allocated at once
+	int numbers[] = { 4, 8, 15, 16, 23, 42 };
+	containers::LinkedListPointers<int> fromRange(numbers, numbers + 6);
 }
 
 void LinkedListWithArrayExample()
@@ -79,8 +101,25 @@ void LinkedListWithArrayExample()
 	{
 		currentNumber++;
 	}
+
+	// When the capacity is known while compiling, the list keeps everything inside itself, here on the stack,
+	// and never allocates. Its links are single bytes, since 100 slots fit in them.
+	containers::StaticLinkedListArray<int, 100> staticArray;
+	staticArray.Append(3);
+	staticArray += staticArray;
+}
+
+// A static list can even be filled while compiling
+constexpr auto GetFirstOddNumbers()
+{
+	containers::StaticLinkedListArray<int, 8> numbers;
+	for (int number = 0; number < 16; number++) numbers.Append(number).RemoveIf([](int current) { return current % 2 == 0; });
+
+	return numbers;
 }
 
+static_assert(GetFirstOddNumbers().Last() == 15, "The list should have been filled while compiling");
+
 void StackExample()
 {
 	// Regular usage of stack of ints
@@ -99,4 +138,24 @@ void StackExample()
 	containers::Stack<int, containers::LinkedListArray<int>> newStack;
 
 	// Don't do it though, they asked us to make the stack unlimited in its size
+
+	// The pmr stack takes its memory from a memory resource, here an arena that's freed all at once when it goes away
+	std::pmr::monotonic_buffer_resource arena;
+	containers::pmr::Stack<int> arenaStack(&arena);
+	arenaStack.Push(4);
+}
+
+void PersistentListExample()
+{
+	// A persistent list never changes the nodes it already has, so copies share them
+	containers::PersistentList<int> list;
+	list.Prepend(3).Prepend(2).Prepend(1); // 1, 2, 3
+
+	// The copy is O(1), and it keeps seeing 1, 2, 3 no matter what happens to 'list' (even from another thread)
+	containers::PersistentList<int> snapshot(list);
+	list.RemoveFirst().Prepend(0); // 0, 2, 3
+
+	// Converting from and to the other lists
+	containers::LinkedListPointers<int> regularList = snapshot.ToLinkedListPointers();
+	containers::PersistentList<int> fromRegularList(regularList.begin(), regularList.end());
 }
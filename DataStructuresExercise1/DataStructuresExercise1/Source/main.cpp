@@ -1,213 +1,258 @@
 
+#include <cstddef>
 #include <iostream>
+#include <memory_resource>
+#include <thread>
 #include <vector>
 #include <string>
-#include <sstream>
-#include <math.h>
+#include "DataStructures/BufferResource.h"
 #include "DataStructures/LinkedList/LinkedListPointers.h"
 #include "DataStructures/LinkedList/LinkedListArray.h"
 #include "DataStructures/Stack.h"
+#include "Country/BatchQueries.h"
+#include "Country/Country.h"
+#include "Country/ExternalReachability.h"
+#include "Country/Generator.h"
+#include "Country/Reordering.h"
+#include "Country/ShortestPaths.h"
+#include "Country/UserIO.h"
+#include "Benchmarks/Benchmarks.h"
 
 using namespace std;
 using namespace containers;
+using namespace reordering;
 
-using Color = bool;
-constexpr auto WHITE = true;
-constexpr auto BLACK = false;
+// Small queries fit entirely in a buffer on the stack, bigger ones carry on with the heap
+constexpr size_t QUERY_BUFFER_SIZE = 16 * 1024;
 
-struct UserInput
+template<typename CountryType>
+void PrintTraversals(const CountryType& country, const UserInput& userInput, const Relabeling& relabeling, const string& traversal)
 {
-    struct Pair
+    // The traversals run on the relabeled country, and the towns are translated back before printing
+    auto source = relabeling.ToNew(userInput.source - 1);
+
+    // A query allocates from a buffer on the stack first and then from a pool, which reuses what the traversals free
+    // (stack nodes, copies of the towns), so the memory of a query grows with what's alive at once and not with everything it ever pushed
+    alignas(std::max_align_t) std::byte buffer[QUERY_BUFFER_SIZE];
+    std::pmr::unsynchronized_pool_resource pool;
+    containers::pmr::BufferResource arena(buffer, sizeof(buffer), &pool);
+    std::pmr::polymorphic_allocator<unsigned int> allocator(&arena);
+
+    if (traversal != "breadth")
     {
-        unsigned int source;
-        unsigned int destination;
-    };
+        cout << "Cities accessible from source city " << userInput.source << " (recursive algorithm): ";
 
-    unsigned int numberOfTowns;
-    std::vector<Pair> pairs;
-    unsigned int source;
-};
+        containers::pmr::LinkedListArray<unsigned int> accessibleTowns(country.size(), allocator);
+        std::pmr::vector<Color> coloredTowns(country.size(), WHITE, allocator);
+        recursive::GetToTown(country, source, coloredTowns, accessibleTowns);
+        PrintAccessibleTowns(RestoreOriginalTowns(accessibleTowns, relabeling));
 
-auto GetCountryFromUserInput(const UserInput& userInput)
+        cout << "Cities accessible from source city " << userInput.source << " (iterative algorithm): ";
+        PrintAccessibleTowns(RestoreOriginalTowns(iterative::GetToTown(country, source, allocator), relabeling));
+    }
+
+    if (traversal != "depth")
+    {
+        cout << "Cities accessible from source city " << userInput.source << " (breadth first algorithm): ";
+        PrintAccessibleTowns(RestoreOriginalTowns(breadthfirst::GetToTown(country, source, allocator), relabeling));
+    }
+}
+
+template<typename CountryType>
+auto BuildCountry(const UserInput& userInput, Strategy strategy, Relabeling& relabeling)
 {
-    vector<LinkedListPointers<unsigned int>> country(userInput.numberOfTowns);
+    auto country = GetCountryFromUserInput<CountryType>(userInput);
 
-    for (const auto& pair : userInput.pairs)
+    if (strategy != Strategy::NONE)
     {
-        country[pair.source - 1].Append(pair.destination - 1);
+        relabeling = ComputeRelabeling(country, strategy);
+        country = Relabel(country, relabeling);
     }
 
     return country;
 }
 
-namespace recursive
+template<typename Codec>
+auto Compress(const Country& country, const UserInput& userInput)
+{
+    // Without relabeling there are no linked lists, and the roads are compressed straight from the input
+    return country.empty() ? GetCompressedCountryFromUserInput<Codec>(userInput) : CompressedCountry<Codec>(country);
+}
+
+int main(int argc, char* argv[])
 {
-    void GetToTown(const vector<LinkedListPointers<unsigned int>>& country,
-                   unsigned int townNumber,
-                   vector<Color>& coloredTowns,
-                   LinkedListArray<unsigned int>& accessibleTowns)
+    try
     {
-        coloredTowns[townNumber] = BLACK;
-        accessibleTowns.Append(townNumber);
+        vector<string> arguments(argv + 1, argv + argc);
 
-        for (const auto& neighbor : country[townNumber])
+        if (!arguments.empty() && arguments[0] == "--benchmark")
         {
-            if (coloredTowns[neighbor] == WHITE)
-            {
-                GetToTown(country, neighbor, coloredTowns, accessibleTowns);
-            }
+            if (arguments.size() < 2) throw "Missing benchmark name!";
+            benchmarks::RunBenchmark(arguments[1], vector<string>(arguments.begin() + 2, arguments.end()));
+            return 0;
         }
-    }
-};
 
-namespace iterative
-{
-    auto GetToTown(const vector<LinkedListPointers<unsigned int>>& country,
-                   unsigned int townNumber)
-    {
-        struct ItemType
+        if (!arguments.empty() && arguments[0] == "--generate")
         {
-            // Enums
-            enum class Line
-            {
-                START,
-                LOOP
-            };
-
-            // Local Variables
-            LinkedListArray<unsigned int>* accessibleTowns = nullptr;
-            vector<Color>* coloredTowns = nullptr;
-            LinkedListPointers<unsigned int>::LinkedNode neighborIterator;
-
-            // Parameters
-            const vector<LinkedListPointers<unsigned int>>* country = nullptr;
-            unsigned int townNumber = 0;
-
-            // Line
-            Line line = Line::START;
-        };
-
-        LinkedListArray<unsigned int> accessibleTowns(country.size());
-        vector<Color> coloredTowns(country.size(), WHITE);
-
-        Stack<ItemType> stack;
-        stack.Push({ &accessibleTowns, 
-                     &coloredTowns, 
-                     country[townNumber].begin(),
-                     &country, 
-                     townNumber, 
-                     ItemType::Line::START });
-
-        while (!stack.IsEmpty())
-        {
-            ItemType current = stack.Pop();
+            if (arguments.size() < 3) throw "Usage: --generate <shape> <towns> [roads] [seed] [source] [max weight] [destination]";
+            generator::WriteCountry(cout,
+                                    generator::ParseShape(arguments[1]),
+                                    generator::ParseNumberOfTowns(arguments[2]),
+                                    arguments.size() > 3 ? stoull(arguments[3]) : 0,
+                                    arguments.size() > 4 ? stoull(arguments[4]) : 1,
+                                    arguments.size() > 5 ? static_cast<unsigned int>(stoul(arguments[5])) : 1,
+                                    arguments.size() > 6 ? static_cast<unsigned int>(stoul(arguments[6])) : 0,
+                                    arguments.size() > 7 ? static_cast<unsigned int>(stoul(arguments[7])) : NO_DESTINATION);
+            return 0;
+        }
 
-            if (current.line == ItemType::Line::START)
+        auto strategy = Strategy::NONE;
+        string compression = "none";
+        string lists = "pointers";
+        string traversal = "depth";
+        string weighted = "none";
+        int batchWorkers = -1;
+        unsigned int buildWorkers = 0;
+        size_t externalMemoryBudget = 0;
+        for (size_t index = 0; index < arguments.size(); index += 2)
+        {
+            if (index + 1 == arguments.size()) throw "Missing the value of a command line option!";
+
+            if (arguments[index] == "--reorder") strategy = ParseStrategy(arguments[index + 1]);
+            else if (arguments[index] == "--compressed") compression = arguments[index + 1];
+            else if (arguments[index] == "--lists") lists = arguments[index + 1];
+            else if (arguments[index] == "--traversal") traversal = arguments[index + 1];
+            else if (arguments[index] == "--weighted") weighted = arguments[index + 1];
+            else if (arguments[index] == "--batch") batchWorkers = stoi(arguments[index + 1]);
+            else if (arguments[index] == "--build-workers") buildWorkers = static_cast<unsigned int>(stoul(arguments[index + 1]));
+            else if (arguments[index] == "--external")
             {
-                (*current.coloredTowns)[current.townNumber] = BLACK;
-                current.accessibleTowns->Append(current.townNumber);
-                current.line = ItemType::Line::LOOP;
+                // A budget of 0 would look like external mode was never asked for
+                externalMemoryBudget = static_cast<size_t>(stoull(arguments[index + 1])) * 1024 * 1024;
+                if (externalMemoryBudget == 0) throw "The memory budget of --external must be at least 1MB!";
             }
+            else throw "Unknown command line option!";
+        }
 
-            if (current.line == ItemType::Line::LOOP)
-            {
-                while (current.neighborIterator != (*current.country)[current.townNumber].end() &&
-                       (*current.coloredTowns)[*current.neighborIterator] != WHITE)
-                {
-                    ++current.neighborIterator;
-                }
+        if (compression != "none" && compression != "varint" && compression != "group") throw "Unknown compression! (expected none, varint or group)";
+        if (lists != "pointers" && lists != "small" && lists != "csr") throw "Unknown lists! (expected pointers, small or csr)";
+        if (traversal != "depth" && traversal != "breadth" && traversal != "all") throw "Unknown traversal! (expected depth, breadth or all)";
 
-                if (current.neighborIterator != (*current.country)[current.townNumber].end())
-                {
-                    stack.Push(current);
+        // The compressed countries are made from the pointer lists, and the batch, external and weighted modes
+        // each answer with a traversal of their own, so the options that shape the regular traversals can't go with them
+        const auto isBatch = batchWorkers >= 0;
+        const auto isExternal = externalMemoryBudget != 0;
+        const auto isWeighted = weighted != "none";
+        const auto hasTraversalOptions = strategy != Strategy::NONE || compression != "none" || lists != "pointers" || traversal != "depth" || buildWorkers != 0;
+
+        if (compression != "none" && lists != "pointers") throw "--compressed only works with the pointer lists!";
+        if (isBatch + isExternal + isWeighted > 1) throw "Only one of --batch, --external and --weighted can be used at a time!";
+        if ((isBatch || isExternal || isWeighted) && hasTraversalOptions)
+        {
+            throw "--batch, --external and --weighted can't be used with --reorder, --compressed, --lists, --traversal or --build-workers!";
+        }
 
-                    stack.Push({ current.accessibleTowns,
-                                 current.coloredTowns,
-                                 (*current.country)[*current.neighborIterator].begin(),
-                                 current.country,
-                                 *current.neighborIterator,
-                                 ItemType::Line::START });
-                }
+        if (isExternal)
+        {
+            // The country never enters memory, it's sorted into a temporary file and traversed from there.
+            // Creating the file removes everything it wrote when it fails, and the file is removed however the traversal ends.
+            auto country = external::CreateExternalCountry(cin, external::GetTemporaryPath(), externalMemoryBudget);
 
+            try
+            {
+                auto visited = external::GetToTown(country, country.source - 1, externalMemoryBudget);
+                cout << "Cities accessible from source city " << country.source << " (external algorithm): ";
+                external::PrintAccessibleTowns(visited, cout);
+            }
+            catch (...)
+            {
+                external::DeleteExternalCountry(country);
+                throw;
             }
+
+            external::DeleteExternalCountry(country);
+            return 0;
         }
 
-        return accessibleTowns;
-    }
-};
+        if (isWeighted)
+        {
+            // The input has weighted roads and a destination, and the answer is a travel cost instead of the reachable towns
+            const auto heap = dijkstra::ParseHeap(weighted);
+            const auto weightedInput = GetWeightedUserInput();
+            const auto country = GetWeightedCountryFromUserInput(weightedInput);
+            const auto source = weightedInput.source - 1;
 
-void PrintAccessibleTowns(const LinkedListArray<unsigned int>& accessibleTowns)
-{
-    for (const auto& accessibleTown : accessibleTowns)
-    {
-        cout << (accessibleTown + 1) << " ";
-    }
+            if (weightedInput.destination == NO_DESTINATION)
+            {
+                cout << "Travel costs from source city " << weightedInput.source << ": ";
+                PrintCosts(dijkstra::GetCosts(country, source, dijkstra::ALL_TOWNS, heap), dijkstra::UNREACHABLE);
+            }
+            else
+            {
+                const auto destination = weightedInput.destination - 1;
+                const auto cost = dijkstra::GetCosts(country, source, destination, heap)[destination];
 
-    cout << "\n";
-}
+                cout << "Travel cost from source city " << weightedInput.source << " to city " << weightedInput.destination << ": ";
+                if (cost == dijkstra::UNREACHABLE) cout << "unreachable\n";
+                else cout << cost << "\n";
+            }
 
-auto GetUserInput()
-{
-    // Get the number of towns and the number of pairs seperated by a space
-    int numberOfTowns;
-    int numberOfPairs;
-    cin >> numberOfTowns >> numberOfPairs;
-    bool wasInvalid = cin.fail() || numberOfTowns <= 0 || numberOfPairs < 0 || numberOfPairs > pow(numberOfTowns, numberOfTowns);
-    cin.ignore(1, '\n');
-
-    // Get the line of town connections
-    string townConnectionsInput;
-    getline(cin, townConnectionsInput);
-    wasInvalid = wasInvalid || cin.fail();
-
-    // Count the number of towns received
-    unsigned int numberOfTownsReceived = 0;
-    int townNumber;
-    stringstream stream(townConnectionsInput);
-    while (stream >> townNumber)
-    {
-        if (townNumber > numberOfTowns || townNumber <= 0)
-        {
-            wasInvalid = true;
-            break;
+            return 0;
         }
 
-        numberOfTownsReceived++;
-    }
+        auto userInput = GetUserInput();
 
-    wasInvalid = wasInvalid || numberOfTownsReceived % 2 != 0 || numberOfTownsReceived / 2 != numberOfPairs;
+        if (isBatch)
+        {
+            // The country is built once, the source on its last line is the first query and the rest of the input holds the others
+            const auto country = GetCountryFromUserInput(userInput);
+            auto isFirstQuery = true;
 
-    // Get the source town
-    int source;
-    cin >> source;
+            batch::AnswerQueries(country, [&](int64_t& townNumber)
+            {
+                if (!isFirstQuery) return static_cast<bool>(cin >> townNumber);
 
-    stream = stringstream(townConnectionsInput);
+                isFirstQuery = false;
+                townNumber = userInput.source;
+                return true;
+            }, cout, batchWorkers != 0 ? static_cast<unsigned int>(batchWorkers) : thread::hardware_concurrency());
 
-    // The college wanted us to first receive all of the input and then check for validity, so we only check now.
-    if (wasInvalid || cin.fail() || source > numberOfTowns || source <= 0) throw "invalid input";
+            return 0;
+        }
+        auto relabeling = GetIdentityRelabeling(userInput.numberOfTowns);
 
-    UserInput userInput = {static_cast<unsigned int>(numberOfTowns), std::vector<UserInput::Pair>(numberOfTownsReceived / 2), static_cast<unsigned int>(source)};
-    for (auto& pair : userInput.pairs) stream >> pair.source >> pair.destination;
+        if (compression == "none" && lists == "small")
+        {
+            auto smallCountry = BuildCountry<SmallCountry>(userInput, strategy, relabeling);
+            PrintTraversals(smallCountry, userInput, relabeling, traversal);
+            return 0;
+        }
 
-    return userInput;
-}
+        if (compression == "none" && lists == "csr")
+        {
+            // The roads are laid out by a pool of workers, and relabeling lays them out again with the new town numbers
+            const auto workers = buildWorkers != 0 ? buildWorkers : max(thread::hardware_concurrency(), 1u);
+            auto csrCountry = GetCsrCountryFromUserInput(userInput, workers);
 
-int main()
-{
-    try
-    {
-        auto userInput = GetUserInput();
-        auto country = GetCountryFromUserInput(userInput);
+            if (strategy != Strategy::NONE)
+            {
+                relabeling = ComputeRelabeling(csrCountry, strategy);
+                csrCountry = CsrCountry(userInput.numberOfTowns, userInput.pairs, [&relabeling](const UserInput::Pair& pair)
+                {
+                    return make_pair(relabeling.ToNew(pair.source - 1), relabeling.ToNew(pair.destination - 1));
+                }, workers);
+            }
 
-        cout << "Cities accessible from source city " << userInput.source << " (recursive algorithm): ";
+            PrintTraversals(csrCountry, userInput, relabeling, traversal);
+            return 0;
+        }
 
-        LinkedListArray<unsigned int> accessibleTowns(country.size());
-        vector<Color> coloredTowns(country.size(), WHITE);
-        recursive::GetToTown(country, userInput.source - 1, coloredTowns, accessibleTowns);
-        PrintAccessibleTowns(accessibleTowns);
+        Country country;
+        if (compression == "none" || strategy != Strategy::NONE) country = BuildCountry<Country>(userInput, strategy, relabeling);
 
-        cout << "Cities accessible from source city " << userInput.source << " (iterative algorithm): ";
-        PrintAccessibleTowns(iterative::GetToTown(country, userInput.source - 1));
+        if (compression == "varint") PrintTraversals(Compress<codecs::Varint>(country, userInput), userInput, relabeling, traversal);
+        else if (compression == "group") PrintTraversals(Compress<codecs::GroupVarint>(country, userInput), userInput, relabeling, traversal);
+        else PrintTraversals(country, userInput, relabeling, traversal);
     }
     catch (const char* errorMessage)
     {
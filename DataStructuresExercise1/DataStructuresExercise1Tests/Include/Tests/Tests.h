@@ -0,0 +1,50 @@
+#ifndef INCLUDE_TESTS_TESTS__H
+#define INCLUDE_TESTS_TESTS__H
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace tests
+{
+	// Fails the running test with 'failure' (the expectation that didn't hold) when 'condition' is false
+	inline void Check(bool condition, const char* failure)
+	{
+		if (!condition) throw failure;
+	}
+
+	// Fails the running test unless 'function' throws a 'const char*'
+	template<typename Function>
+	inline void CheckThrows(Function&& function, const char* failure)
+	{
+		bool hasThrown = false;
+		try { function(); }
+		catch (const char*) { hasThrown = true; }
+
+		Check(hasThrown, failure);
+	}
+
+	// The elements of any of the containers in the order its iterators go over them. Containers of bool hand out
+	// proxies rather than the elements, so those need 'ElementType' to get a vector of bool.
+	template<typename Container, typename ElementType = typename std::decay<decltype(*std::declval<const Container&>().begin())>::type>
+	inline auto ToVector(const Container& container)
+	{
+		std::vector<ElementType> elements;
+		for (const auto& element : container) elements.push_back(element);
+
+		return elements;
+	}
+
+	// Tests (every test throws the expectation that failed, and returns when all of them held)
+	void TestSort();
+	void TestRadixSort();
+	void TestHandles();
+	void TestDynamicCountry();
+	void TestDeque();
+	void TestPersistentList();
+	void TestAdjacencyArray();
+	void TestCompressedAdjacency();
+	void TestExternalReachability();
+}
+
+#endif // !INCLUDE_TESTS_TESTS__H
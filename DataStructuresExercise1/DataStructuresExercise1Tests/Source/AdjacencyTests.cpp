@@ -0,0 +1,116 @@
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "Country/Country.h"
+#include "Country/Generator.h"
+#include "Tests/Tests.h"
+
+using namespace std;
+
+namespace
+{
+	// The neighbors of every town in the order of the input, as the lists of the regular country hold them
+	auto GetNeighborsInInputOrder(const UserInput& userInput)
+	{
+		vector<vector<unsigned int>> neighbors(userInput.numberOfTowns);
+		for (const auto& pair : userInput.pairs) neighbors[pair.source - 1].push_back(pair.destination - 1);
+
+		return neighbors;
+	}
+
+	auto GetSortedAndUnique(vector<vector<unsigned int>> neighbors)
+	{
+		for (auto& townNeighbors : neighbors)
+		{
+			sort(townNeighbors.begin(), townNeighbors.end());
+			townNeighbors.erase(unique(townNeighbors.begin(), townNeighbors.end()), townNeighbors.end());
+		}
+
+		return neighbors;
+	}
+
+	template<typename CountryType>
+	auto HasNeighbors(const CountryType& country, const vector<vector<unsigned int>>& neighbors)
+	{
+		if (country.size() != neighbors.size()) return false;
+
+		for (size_t town = 0; town < neighbors.size(); town++)
+		{
+			if (country[town].Size() != neighbors[town].size() || tests::ToVector(country[town]) != neighbors[town]) return false;
+		}
+
+		return true;
+	}
+
+	// Random roads with many repeats, a grid, and a country where most towns have no roads at all
+	auto GetUserInputs()
+	{
+		vector<UserInput> userInputs;
+		userInputs.push_back(generator::GenerateUserInput(generator::Shape::RANDOM, 1000, 20000, 1));
+		userInputs.push_back(generator::GenerateUserInput(generator::Shape::POWER_LAW, 5000, 50000, 2));
+		userInputs.push_back(generator::GenerateUserInput(generator::Shape::GRID, 2500, 0, 3));
+		userInputs.push_back(generator::GenerateUserInput(generator::Shape::RANDOM, 100000, 1000, 4));
+		userInputs.push_back(generator::GenerateUserInput(generator::Shape::RANDOM, 10, 0, 5));
+
+		return userInputs;
+	}
+}
+
+void tests::TestAdjacencyArray()
+{
+	for (const auto& userInput : GetUserInputs())
+	{
+		const auto neighbors = GetNeighborsInInputOrder(userInput);
+		const auto sortedNeighbors = GetSortedAndUnique(neighbors);
+
+		// Whatever the number of workers, every town keeps its roads in the order of the input
+		for (const unsigned int numberOfWorkers : { 1, 2, 3, 8 })
+		{
+			const auto country = GetCsrCountryFromUserInput(userInput, numberOfWorkers);
+			Check(HasNeighbors(country, neighbors), "The array doesn't hold the roads of every town in the order of the input!");
+			Check(country.NumberOfEdges() == userInput.pairs.size(), "The array didn't count every road!");
+
+			const auto sortedCountry = GetCsrCountryFromUserInput(userInput, numberOfWorkers, true);
+			Check(HasNeighbors(sortedCountry, sortedNeighbors), "The sorted array doesn't hold the sorted and unique roads of every town!");
+		}
+
+		// The traversals reach the same towns in the same order as on the lists
+		const auto listCountry = GetCountryFromUserInput(userInput);
+		const auto csrCountry = GetCsrCountryFromUserInput(userInput, 4);
+		Check(ToVector(iterative::GetToTown(csrCountry, 0)) == ToVector(iterative::GetToTown(listCountry, 0)), "The array and the lists reach different towns!");
+	}
+}
+
+void tests::TestCompressedAdjacency()
+{
+	for (const auto& userInput : GetUserInputs())
+	{
+		const auto sortedNeighbors = GetSortedAndUnique(GetNeighborsInInputOrder(userInput));
+		size_t numberOfEdges = 0;
+		for (const auto& townNeighbors : sortedNeighbors) numberOfEdges += townNeighbors.size();
+
+		// Both codecs decode exactly the neighbors they were given, whichever constructor built them
+		const auto varintCountry = GetCompressedCountryFromUserInput<containers::codecs::Varint>(userInput);
+		const auto groupCountry = GetCompressedCountryFromUserInput<containers::codecs::GroupVarint>(userInput);
+		const CompressedCountry<> listsCountry(GetNeighborsInInputOrder(userInput));
+		Check(HasNeighbors(varintCountry, sortedNeighbors), "The varint country didn't decode the roads it was given!");
+		Check(HasNeighbors(groupCountry, sortedNeighbors), "The group varint country didn't decode the roads it was given!");
+		Check(HasNeighbors(listsCountry, sortedNeighbors), "The country compressed from lists didn't decode the roads it was given!");
+		Check(varintCountry.NumberOfEdges() == numberOfEdges && groupCountry.NumberOfEdges() == numberOfEdges, "The compressed country didn't count the unique roads!");
+	}
+
+	// Gaps of every byte length, up to the largest town number
+	const vector<uint32_t> destinations = { 0, 1, 127, 128, 255, 256, 16383, 16384, 65535, 65536, 2097151, 2097152, 16777215, 16777216, 268435455, 268435456, UINT32_MAX - 1, UINT32_MAX };
+	vector<pair<uint32_t, uint32_t>> edges;
+	for (auto destination = destinations.rbegin(); destination != destinations.rend(); ++destination)
+	{
+		edges.emplace_back(1, *destination);
+		edges.emplace_back(1, *destination);
+	}
+
+	const vector<vector<unsigned int>> expected = { {}, vector<unsigned int>(destinations.begin(), destinations.end()), {} };
+	auto getEdge = [](const pair<uint32_t, uint32_t>& edge) { return edge; };
+	Check(HasNeighbors(containers::CompressedAdjacency<containers::codecs::Varint>(3, edges, getEdge), expected), "The varint codec lost a large gap!");
+	Check(HasNeighbors(containers::CompressedAdjacency<containers::codecs::GroupVarint>(3, edges, getEdge), expected), "The group varint codec lost a large gap!");
+}
@@ -0,0 +1,101 @@
+#include <deque>
+#include <vector>
+#include "Country/Generator.h"
+#include "DataStructures/Deque.h"
+#include "DataStructures/Queue.h"
+#include "Tests/Tests.h"
+
+using namespace std;
+
+namespace
+{
+	template<typename ElementType>
+	auto IsSame(const containers::Deque<ElementType>& deque, const std::deque<ElementType>& expected)
+	{
+		if (deque.Size() != expected.size()) return false;
+
+		for (size_t index = 0; index < expected.size(); index++)
+		{
+			if (deque[index] != expected[index]) return false;
+		}
+
+		return tests::ToVector(deque) == vector<ElementType>(expected.begin(), expected.end());
+	}
+}
+
+void tests::TestDeque()
+{
+	containers::Deque<unsigned int> deque;
+	std::deque<unsigned int> expected;
+
+	// Prepending to an empty deque wraps the front around to the end of the buffer
+	deque.Prepend(1).Prepend(0);
+	expected = { 0, 1 };
+	const auto capacity = deque.Capacity();
+	Check(IsSame(deque, expected) && deque.First() == 0 && deque.Last() == 1, "Prepending didn't wrap around to the end of the buffer!");
+
+	// Appending until the buffer is full doesn't grow it, since the elements go around the end
+	for (unsigned int element = 2; element < capacity; element++)
+	{
+		deque.Append(element);
+		expected.push_back(element);
+	}
+
+	Check(deque.Capacity() == capacity && IsSame(deque, expected), "Filling a wrapped deque changed its buffer!");
+
+	// Growing while wrapped must unwrap the elements in order
+	deque.Append(capacity);
+	expected.push_back(capacity);
+	Check(deque.Capacity() > capacity && IsSame(deque, expected), "Growing a wrapped deque lost the order of its elements!");
+
+	// Removing from both ends around the wrap point
+	for (unsigned int count = 0; count < 3; count++)
+	{
+		deque.RemoveFirst().Prepend(100 + count).RemoveLast().Append(200 + count);
+		expected.pop_front();
+		expected.push_front(100 + count);
+		expected.pop_back();
+		expected.push_back(200 + count);
+	}
+
+	Check(IsSame(deque, expected), "Removing around the wrap point broke the deque!");
+
+	// Copies and moves of a wrapped deque keep the order
+	const auto copy = deque;
+	Check(IsSame(copy, expected), "Copying a wrapped deque lost the order of its elements!");
+	auto moved = std::move(deque);
+	Check(IsSame(moved, expected) && deque.IsEmpty(), "Moving a wrapped deque lost its elements!");
+
+	// Any mix of the operations must agree with std::deque
+	generator::Random random(3);
+	containers::Deque<unsigned int> mixed;
+	std::deque<unsigned int> mixedExpected;
+	for (unsigned int operation = 0; operation < 100000; operation++)
+	{
+		const auto element = static_cast<unsigned int>(random.Below(1000));
+		switch (mixedExpected.empty() ? random.Below(2) : random.Below(4))
+		{
+		case 0: mixed.Append(element); mixedExpected.push_back(element); break;
+		case 1: mixed.Prepend(element); mixedExpected.push_front(element); break;
+		case 2: mixed.RemoveFirst(); mixedExpected.pop_front(); break;
+		default: mixed.RemoveLast(); mixedExpected.pop_back(); break;
+		}
+
+		if (operation % 1000 == 0) Check(IsSame(mixed, mixedExpected), "The deque and std::deque went apart!");
+	}
+
+	Check(IsSame(mixed, mixedExpected), "The deque and std::deque went apart!");
+	mixed.MakeEmpty();
+	CheckThrows([&]() { mixed.RemoveFirst(); }, "Removing from an empty deque didn't throw!");
+	CheckThrows([&]() { mixed.Last(); }, "Getting from an empty deque didn't throw!");
+
+	// The queue keeps its order however often its deque wraps around
+	containers::Queue<unsigned int> queue;
+	queue.Reserve(16);
+	unsigned int nextToDequeue = 0, nextToEnqueue = 0;
+	for (unsigned int round = 0; round < 100; round++)
+	{
+		while (queue.Size() < 16) queue.Enqueue(nextToEnqueue++);
+		for (unsigned int count = 0; count < 5; count++) Check(queue.Dequeue() == nextToDequeue++, "The queue didn't dequeue in order!");
+	}
+}
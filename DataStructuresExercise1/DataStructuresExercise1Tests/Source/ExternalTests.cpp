@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Country/Country.h"
+#include "Country/ExternalReachability.h"
+#include "Country/Generator.h"
+#include "Tests/Tests.h"
+
+using namespace std;
+
+namespace
+{
+	// Removes the road file however the test that made it ends
+	class RemovedCountry
+	{
+	public:
+		// Constructors
+		explicit RemovedCountry(external::ExternalCountry country) : country(std::move(country)) {}
+		RemovedCountry(const RemovedCountry& other) = delete;
+
+		// Destructor
+		~RemovedCountry() { external::DeleteExternalCountry(country); }
+
+		// Assignment Operator Methods
+		RemovedCountry& operator=(const RemovedCountry& other) = delete;
+
+		// Getters
+		inline const auto& Get() const { return country; }
+
+	private:
+		// Data Members
+		external::ExternalCountry country;
+	};
+
+	// The zero based towns of the bitmap, from the lowest to the highest
+	auto GetTowns(const vector<uint64_t>& visited)
+	{
+		vector<unsigned int> towns;
+		for (size_t word = 0; word < visited.size(); word++)
+		{
+			for (unsigned int bit = 0; bit < 64; bit++)
+			{
+				if (visited[word] & (uint64_t(1) << bit)) towns.push_back(static_cast<unsigned int>(word * 64 + bit));
+			}
+		}
+
+		return towns;
+	}
+
+	auto ReadRoads(const string& path)
+	{
+		external::details::RoadReader reader(path, 1024);
+		vector<external::Road> roads;
+		external::Road road;
+		while (reader.Next(road)) roads.push_back(road);
+
+		return roads;
+	}
+
+	void TestCountry(generator::Shape shape, unsigned int numberOfTowns, uint64_t numberOfRoads, uint64_t seed, unsigned int source, size_t creationBudget)
+	{
+		stringstream text;
+		generator::WriteCountry(text, shape, numberOfTowns, numberOfRoads, seed, source);
+		const auto userInput = GetUserInput(text);
+
+		text.clear();
+		text.seekg(0);
+		const auto path = external::GetTemporaryPath("external-test");
+		const RemovedCountry country(external::CreateExternalCountry(text, path, creationBudget));
+		tests::Check(country.Get().numberOfTowns == numberOfTowns && country.Get().source == source && country.Get().numberOfRoads == userInput.pairs.size(),
+					 "The external country didn't read the counts of the input!");
+		tests::Check(!filesystem::exists(external::details::GetRunPath(path, 0)), "Creating the external country left its runs behind!");
+
+		// The file holds every road, sorted by source, with the roads of every town in the order of the input
+		vector<external::Road> expectedRoads;
+		for (const auto& pair : userInput.pairs) expectedRoads.push_back({ pair.source - 1, pair.destination - 1 });
+		stable_sort(expectedRoads.begin(), expectedRoads.end(), [](const external::Road& first, const external::Road& second) { return first.source < second.source; });
+
+		const auto roads = ReadRoads(path);
+		tests::Check(equal(roads.begin(), roads.end(), expectedRoads.begin(), expectedRoads.end(), [](const external::Road& first, const external::Road& second)
+		{
+			return first.source == second.source && first.destination == second.destination;
+		}), "The road file doesn't hold the roads sorted by their source in the order of the input!");
+
+		// The breadth first levels over the file reach the same towns as the traversal in memory, in another order
+		auto expectedTowns = tests::ToVector(iterative::GetToTown(GetCountryFromUserInput(userInput), source - 1));
+		sort(expectedTowns.begin(), expectedTowns.end());
+		const auto towns = GetTowns(external::GetToTown(country.Get(), source - 1, 64 << 20));
+		tests::Check(towns == expectedTowns, "The external traversal reached other towns than the traversal in memory!");
+	}
+}
+
+void tests::TestExternalReachability()
+{
+	// A small creation budget sorts the roads in many runs and merges them in several passes,
+	// and the larger countries take more than one block of roads
+	TestCountry(generator::Shape::RANDOM, 1000, 3000, 1, 1, 1 << 20);
+	TestCountry(generator::Shape::RANDOM, 1000, 3000, 1, 17, 4096);
+	TestCountry(generator::Shape::RANDOM, 100000, 150000, 2, 5, 1 << 16);
+	TestCountry(generator::Shape::GRID, 40000, 0, 3, 123, 1 << 20);
+	TestCountry(generator::Shape::POWER_LAW, 30000, 200000, 4, 2, 1 << 18);
+	TestCountry(generator::Shape::CHAIN, 70000, 0, 5, 1, 1 << 16);
+	TestCountry(generator::Shape::CHAIN, 70000, 0, 5, 70000, 1 << 16);
+	TestCountry(generator::Shape::RANDOM, 1, 0, 6, 1, 4096);
+
+	// The external reader rejects exactly what the regular one does
+	for (const auto& input : { "3 1 1 4\n1\n", "3 2 1 2\n1\n", "3 1 1 2 3\n1\n", "0 0\n\n1\n", "3 1 1 2\n4\n" })
+	{
+		istringstream regularInput(input), externalInput(input);
+		CheckThrows([&]() { GetUserInput(regularInput); }, "The regular reader accepted an invalid input!");
+
+		const auto path = external::GetTemporaryPath("external-test");
+		CheckThrows([&]() { external::CreateExternalCountry(externalInput, path, 1 << 20); }, "The external reader accepted an invalid input!");
+		Check(!filesystem::exists(path), "A failed external country left its road file behind!");
+	}
+
+	// The traversal refuses a budget that can't hold its bitmaps and a block of roads
+	istringstream input("2 1 1 2\n1\n");
+	const RemovedCountry country(external::CreateExternalCountry(input, external::GetTemporaryPath("external-test"), 1 << 20));
+	CheckThrows([&]() { external::GetToTown(country.Get(), 0, 1024); }, "The traversal accepted a budget too small for it!");
+	Check(GetTowns(external::GetToTown(country.Get(), 0, 1 << 20)) == vector<unsigned int>({ 0, 1 }), "The traversal didn't follow the only road!");
+}
@@ -0,0 +1,94 @@
+#include <vector>
+#include "Country/DynamicCountry.h"
+#include "DataStructures/LinkedList/LinkedListArray.h"
+#include "DataStructures/LinkedList/LinkedListPointers.h"
+#include "Tests/Tests.h"
+
+using namespace std;
+
+namespace
+{
+	// Insert and Erase must keep the order of the rest of the list, whichever end they touch
+	template<typename List>
+	void TestHandlesOn(List list)
+	{
+		const auto two = list.Insert(2);
+		const auto four = list.Insert(4);
+		const auto one = list.Insert(two, 1);
+		const auto three = list.Insert(four, 3);
+		const auto five = list.Insert(5);
+		tests::Check(tests::ToVector(list) == vector<unsigned int>({ 1, 2, 3, 4, 5 }), "Insert didn't put the elements in place!");
+		tests::Check(list[one] == 1 && list[three] == 3 && list[five] == 5, "A handle doesn't stand for the element it was given for!");
+
+		list[three] = 30;
+		tests::Check(tests::ToVector(list) == vector<unsigned int>({ 1, 2, 30, 4, 5 }), "Changing an element through its handle didn't change the list!");
+
+		list.Erase(three);
+		tests::Check(tests::ToVector(list) == vector<unsigned int>({ 1, 2, 4, 5 }), "Erasing from the middle broke the list!");
+		list.Erase(one);
+		tests::Check(tests::ToVector(list) == vector<unsigned int>({ 2, 4, 5 }) && list.First() == 2, "Erasing the first element broke the list!");
+		list.Erase(five);
+		tests::Check(tests::ToVector(list) == vector<unsigned int>({ 2, 4 }) && list.Last() == 4, "Erasing the last element broke the list!");
+
+		// The ends are still linked, so the list keeps growing from them
+		list.Append(6);
+		list.Insert(two, 0);
+		tests::Check(tests::ToVector(list) == vector<unsigned int>({ 0, 2, 4, 6 }), "The list didn't grow from its new ends!");
+		tests::Check(list[two] == 2 && list[four] == 4, "Erasing other elements moved the handles!");
+
+		list.Erase(two);
+		list.Erase(four);
+		tests::Check(list.Size() == 2, "Erase didn't update the size!");
+	}
+}
+
+void tests::TestHandles()
+{
+	TestHandlesOn(containers::LinkedListPointers<unsigned int>());
+	TestHandlesOn(containers::LinkedListArray<unsigned int>(8));
+
+	// The array keeps a generation in every handle, so a handle to an erased element is caught even after its slot is reused
+	containers::LinkedListArray<unsigned int> list(2);
+	const auto first = list.Insert(1);
+	list.Insert(2);
+	CheckThrows([&]() { list.Insert(3); }, "Inserting into a full list didn't throw!");
+
+	list.Erase(first);
+	tests::Check(!list.IsValid(first), "A handle stayed valid after its element was erased!");
+	CheckThrows([&]() { list[first]; }, "Reading through an erased handle didn't throw!");
+	CheckThrows([&]() { list.Erase(first); }, "Erasing the same element twice didn't throw!");
+
+	CheckThrows([&]() { list.Insert(first, 3); }, "Inserting before an erased element didn't throw!");
+
+	const auto reused = list.Insert(3);
+	tests::Check(list.IsValid(reused) && !list.IsValid(first), "The handle of a reused slot isn't told apart from the old one!");
+	tests::Check(tests::ToVector(list) == vector<unsigned int>({ 2, 3 }), "Inserting into a reused slot broke the list!");
+
+	CheckThrows([&]() { list.Insert(containers::LinkedListArray<unsigned int>::Handle(), 4); }, "Inserting before an empty handle didn't throw!");
+}
+
+void tests::TestDynamicCountry()
+{
+	DynamicCountry<vector<containers::LinkedListArray<unsigned int>>> country(3);
+
+	// Two roads between the same towns are torn down one at a time
+	const auto first = country.BuildRoad(0, 1);
+	const auto second = country.BuildRoad(0, 1);
+	const auto other = country.BuildRoad(0, 2);
+	tests::Check(country.GetNumberOfRoads() == 3, "Building roads didn't count them!");
+	tests::Check(country.GetDestination(first) == 1 && country.GetDestination(other) == 2, "A road doesn't lead where it was built to!");
+
+	country.TearDownRoad(first);
+	tests::Check(tests::ToVector(country.GetCountry()[0]) == vector<unsigned int>({ 1, 2 }), "Tearing down one of two equal roads didn't keep the other!");
+	tests::Check(country.GetDestination(second) == 1, "Tearing down a road moved another one!");
+
+	CheckThrows([&]() { country.TearDownRoad(first); }, "Tearing down a road twice didn't throw!");
+	CheckThrows([&]() { country.GetDestination(first); }, "Getting the destination of a torn down road didn't throw!");
+	CheckThrows([&]() { country.BuildRoad(0, 3); }, "Building a road to a town outside the country didn't throw!");
+	tests::Check(country.GetNumberOfRoads() == 2, "A road that failed to be torn down was still counted as torn down!");
+
+	// The reachable towns follow the roads as they are right now
+	country.TearDownRoad(second);
+	auto accessibleTowns = tests::ToVector(iterative::GetToTown(country.GetCountry(), 0));
+	tests::Check(accessibleTowns == vector<unsigned int>({ 0, 2 }), "The traversal went over a road that was torn down!");
+}
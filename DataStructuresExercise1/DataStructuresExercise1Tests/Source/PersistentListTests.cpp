@@ -0,0 +1,104 @@
+#include <thread>
+#include <vector>
+#include "DataStructures/LinkedList/PersistentList.h"
+#include "Tests/Tests.h"
+
+using namespace std;
+
+namespace
+{
+	// Counts the elements that are alive, so the test can tell when the shared nodes are freed
+	class Counted
+	{
+	public:
+		// Constructors
+		Counted(unsigned int value) : value(value) { ++alive; }
+		Counted(const Counted& other) : value(other.value) { ++alive; }
+
+		// Destructor
+		~Counted() { --alive; }
+
+		// Getters
+		inline auto GetValue() const { return value; }
+		inline auto operator==(const Counted& other) const { return value == other.value; }
+
+		static unsigned int alive;
+
+	private:
+		// Data Members
+		unsigned int value;
+	};
+
+	unsigned int Counted::alive = 0;
+
+	auto GetValues(const containers::PersistentList<Counted>& list)
+	{
+		vector<unsigned int> values;
+		for (const auto& element : list) values.push_back(element.GetValue());
+
+		return values;
+	}
+}
+
+void tests::TestPersistentList()
+{
+	{
+		const vector<unsigned int> values = { 1, 2, 3 };
+		containers::PersistentList<Counted> list(values.begin(), values.end());
+		Check(GetValues(list) == values && list.Size() == 3, "The range constructor didn't keep the order of the range!");
+
+		// Prepending to a copy adds a single node in front of the shared ones
+		auto longer = list;
+		longer.Prepend(0);
+		Check(GetValues(list) == vector<unsigned int>({ 1, 2, 3 }), "Prepending to a copy changed the original!");
+		Check(GetValues(longer) == vector<unsigned int>({ 0, 1, 2, 3 }), "Prepending didn't put the element first!");
+		Check(longer.Rest().begin() == list.begin() && Counted::alive == 4, "The copy didn't share the nodes of the original!");
+
+		// Removing from the original keeps the nodes that the copy still reaches
+		auto rest = list.Rest();
+		list.RemoveFirst().RemoveFirst();
+		Check(GetValues(list) == vector<unsigned int>({ 3 }) && GetValues(rest) == vector<unsigned int>({ 2, 3 }), "Removing from a list changed its copies!");
+		Check(Counted::alive == 4, "A node that other lists reach was freed!");
+
+		longer.Clear();
+		Check(Counted::alive == 2 && GetValues(rest) == vector<unsigned int>({ 2, 3 }), "Clearing a list didn't free only the nodes nobody else reaches!");
+
+		// Assigning a list a part of itself must keep that part alive
+		rest = rest.Rest();
+		Check(GetValues(rest) == vector<unsigned int>({ 3 }) && rest.begin() == list.begin(), "Assigning a list a part of itself broke it!");
+
+		CheckThrows([]() { containers::PersistentList<Counted>().RemoveFirst(); }, "Removing from an empty list didn't throw!");
+	}
+
+	Check(Counted::alive == 0, "The nodes weren't freed when the last list that reaches them was gone!");
+
+	// A long list is freed without a recursion, so it can't overflow the stack
+	{
+		containers::PersistentList<unsigned int> list;
+		for (unsigned int element = 0; element < 1000000; element++) list.Prepend(element);
+	}
+
+	// Snapshots are read by other threads while the list they came from moves on
+	containers::PersistentList<unsigned int> list;
+	vector<thread> readers;
+	vector<unsigned long long> sums(8, 0);
+	for (unsigned int reader = 0; reader < sums.size(); reader++)
+	{
+		for (unsigned int element = 0; element < 1000; element++) list.Prepend(element);
+
+		readers.emplace_back([snapshot = list, &sum = sums[reader]]()
+		{
+			for (const auto& element : snapshot) sum += element;
+		});
+
+		list.RemoveFirst();
+	}
+
+	for (auto& reader : readers) reader.join();
+	for (unsigned int reader = 0; reader < sums.size(); reader++)
+	{
+		Check(sums[reader] == (reader + 1) * 499500ull - 999ull * reader, "A snapshot changed while another thread read it!");
+	}
+
+	Check(list.ToLinkedListArray().Size() == list.Size() && list.ToLinkedListPointers().First() == list.First(), "Converting the list lost its elements!");
+}
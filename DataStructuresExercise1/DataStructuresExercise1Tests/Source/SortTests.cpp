@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "Country/Generator.h"
+#include "DataStructures/LinkedList/LinkedListArray.h"
+#include "DataStructures/LinkedList/LinkedListPointers.h"
+#include "Tests/Tests.h"
+
+using namespace std;
+
+namespace
+{
+	struct Item
+	{
+		unsigned int key;
+		unsigned int order;	// Where the item was in the input, to tell whether equal keys kept it
+
+		// The iterators of the lists compare the elements they stand on
+		inline auto operator!=(const Item& other) const { return key != other.key || order != other.order; }
+	};
+
+	// Values that take every byte of the type, with many repeats among the small ones
+	template<typename ElementType>
+	auto GetRandomValues(size_t count, uint64_t seed)
+	{
+		generator::Random random(seed);
+		vector<ElementType> values(count);
+		for (auto& value : values)
+		{
+			value = static_cast<ElementType>(random.Below(2) == 0 ? random.Below(16) : random.Below(UINT64_MAX));
+		}
+
+		return values;
+	}
+
+	// The list must hold the elements in order, and still work as a list afterwards
+	template<typename List, typename ElementType>
+	void CheckSortedList(List& list, vector<ElementType> expected)
+	{
+		tests::Check(tests::ToVector<List, ElementType>(list) == expected, "The sorted list doesn't hold the sorted elements!");
+		tests::Check(list.Size() == expected.size(), "Sorting changed the size of the list!");
+
+		if (expected.empty()) return;
+		tests::Check(list.First() == expected.front() && list.Last() == expected.back(), "Sorting didn't relink the ends of the list!");
+
+		list.Append(expected.front());
+		expected.push_back(expected.front());
+		tests::Check(tests::ToVector<List, ElementType>(list) == expected, "Appending after sorting didn't go to the end of the list!");
+	}
+
+	template<typename List>
+	void TestSortOn(const List& empty)
+	{
+		for (const size_t count : { 0, 1, 2, 3, 100, 5000 })
+		{
+			const auto values = GetRandomValues<unsigned int>(count, count + 1);
+			auto sorted = values;
+			std::sort(sorted.begin(), sorted.end());
+
+			auto list = empty;
+			list.Append(values.begin(), values.end());
+			list.Sort();
+			CheckSortedList(list, sorted);
+
+			list = empty;
+			list.Append(values.begin(), values.end());
+			list.Sort(greater<unsigned int>());
+			CheckSortedList(list, vector<unsigned int>(sorted.rbegin(), sorted.rend()));
+		}
+	}
+
+	// Items with equal keys must keep the order they came in
+	template<typename List>
+	void TestStableSortOn(List list)
+	{
+		vector<Item> items;
+		generator::Random random(7);
+		for (unsigned int order = 0; order < 3000; order++) items.push_back({ static_cast<unsigned int>(random.Below(10)), order });
+
+		auto byKey = [](const Item& first, const Item& second) { return first.key < second.key; };
+		auto sortedItems = items;
+		stable_sort(sortedItems.begin(), sortedItems.end(), byKey);
+
+		list.Append(items.begin(), items.end());
+		list.Sort(byKey);
+
+		const auto sortedList = tests::ToVector(list);
+		tests::Check(equal(sortedList.begin(), sortedList.end(), sortedItems.begin(), sortedItems.end(), [](const Item& first, const Item& second)
+		{
+			return !(first != second);
+		}), "Merge sort isn't stable!");
+	}
+
+	template<typename ElementType, typename List>
+	void TestRadixSortOn(List list)
+	{
+		const auto values = GetRandomValues<ElementType>(20000, sizeof(ElementType));
+		auto sorted = values;
+		std::sort(sorted.begin(), sorted.end());
+
+		list.Append(values.begin(), values.end());
+		list.RadixSort();
+		CheckSortedList(list, sorted);
+	}
+}
+
+void tests::TestSort()
+{
+	TestSortOn(containers::LinkedListPointers<unsigned int>());
+	TestSortOn(containers::LinkedListArray<unsigned int>(20000));
+	TestStableSortOn(containers::LinkedListPointers<Item>());
+	TestStableSortOn(containers::LinkedListArray<Item>(3000));
+
+	// Lists of bool have no radix sort, so sorting them merges
+	containers::LinkedListArray<bool> flags(100);
+	containers::LinkedListPointers<bool> pointerFlags;
+	vector<bool> expected;
+	for (unsigned int index = 0; index < 99; index++)
+	{
+		flags.Append(index % 3 == 0);
+		pointerFlags.Append(index % 3 == 0);
+		expected.push_back(index % 3 == 0);
+	}
+
+	sort(expected.begin(), expected.end());
+	flags.Sort();
+	pointerFlags.Sort();
+	CheckSortedList(flags, expected);
+	CheckSortedList(pointerFlags, expected);
+}
+
+void tests::TestRadixSort()
+{
+	TestRadixSortOn<unsigned int>(containers::LinkedListPointers<unsigned int>());
+	TestRadixSortOn<unsigned int>(containers::LinkedListArray<unsigned int>(20001));
+	TestRadixSortOn<uint8_t>(containers::LinkedListPointers<uint8_t>());
+	TestRadixSortOn<uint64_t>(containers::LinkedListArray<uint64_t>(20001));
+
+	// The slots freed in the middle of the array must not get into the sorted list
+	containers::LinkedListArray<unsigned int> list(1000);
+	for (unsigned int element = 1000; element > 0; element--) list.Append(element);
+	list.RemoveIf([](unsigned int element) { return element % 4 == 0; });
+	list.RadixSort();
+
+	vector<unsigned int> expected;
+	for (unsigned int element = 1; element <= 1000; element++) if (element % 4 != 0) expected.push_back(element);
+	CheckSortedList(list, expected);
+}
@@ -0,0 +1,51 @@
+#include <exception>
+#include <iostream>
+#include "Tests/Tests.h"
+
+using namespace std;
+
+int main()
+{
+    struct Test
+    {
+        const char* name;
+        void (*run)();
+    };
+
+    const Test testList[] = {
+        { "sort", tests::TestSort },
+        { "radix sort", tests::TestRadixSort },
+        { "handles", tests::TestHandles },
+        { "dynamic country", tests::TestDynamicCountry },
+        { "deque", tests::TestDeque },
+        { "persistent list", tests::TestPersistentList },
+        { "adjacency array", tests::TestAdjacencyArray },
+        { "compressed adjacency", tests::TestCompressedAdjacency },
+        { "external reachability", tests::TestExternalReachability },
+    };
+
+    // Every test runs even when one before it failed, and the exit code tells whether any of them did
+    unsigned int numberOfFailures = 0;
+    for (const auto& test : testList)
+    {
+        try
+        {
+            test.run();
+            cout << "passed: " << test.name << endl;
+        }
+        catch (const char* errorMessage)
+        {
+            cout << "FAILED: " << test.name << ": " << errorMessage << endl;
+            ++numberOfFailures;
+        }
+        catch (const exception& error)
+        {
+            cout << "FAILED: " << test.name << ": " << error.what() << endl;
+            ++numberOfFailures;
+        }
+    }
+
+    cout << (sizeof(testList) / sizeof(testList[0]) - numberOfFailures) << " of " << sizeof(testList) / sizeof(testList[0]) << " tests passed" << endl;
+
+    return numberOfFailures == 0 ? 0 : 1;
+}